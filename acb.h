@@ -693,10 +693,16 @@ void acb_log1p(acb_t r, const acb_t z, slong prec);
 void acb_exp(acb_t r, const acb_t z, slong prec);
 void acb_exp_pi_i(acb_t r, const acb_t z, slong prec);
 void acb_exp_invexp(acb_t r, acb_t s, const acb_t z, slong prec);
+void acb_exp_arith_progression(acb_ptr res, const acb_t a, const acb_t d,
+    slong n, slong prec);
 
 void acb_sin(acb_t r, const acb_t z, slong prec);
 void acb_cos(acb_t r, const acb_t z, slong prec);
 void acb_sin_cos(acb_t s, acb_t c, const acb_t z, slong prec);
+void _acb_vec_exp(acb_ptr res, acb_srcptr x, slong len, slong prec);
+void _acb_vec_log(acb_ptr res, acb_srcptr x, slong len, slong prec);
+void _acb_vec_sin_cos(acb_ptr s, acb_ptr c, acb_srcptr x, slong len, slong prec);
+void _acb_vec_lgamma(acb_ptr res, acb_srcptr x, slong len, slong prec);
 void acb_tan(acb_t r, const acb_t z, slong prec);
 void acb_cot(acb_t r, const acb_t z, slong prec);
 
@@ -782,8 +788,23 @@ void acb_log_sin_pi(acb_t res, const acb_t z, slong prec);
 void acb_digamma(acb_t y, const acb_t x, slong prec);
 void acb_zeta(acb_t z, const acb_t s, slong prec);
 void acb_hurwitz_zeta(acb_t z, const acb_t s, const acb_t a, slong prec);
+void acb_zeta_vec(acb_ptr res, acb_srcptr s, slong num, slong prec);
+void acb_hurwitz_zeta_vec_rational(acb_ptr res, const acb_t s, ulong q, slong prec);
 void acb_polygamma(acb_t res, const acb_t s, const acb_t z, slong prec);
 
+/* evaluation to a target accuracy */
+
+typedef void (*acb_eval_func_t)(acb_t res, const acb_t x,
+    void * param, slong prec);
+
+int acb_eval_accurate(acb_t res, acb_eval_func_t func, void * param,
+    const acb_t x, slong target_rel_bits, slong max_prec);
+
+int acb_gamma_accurate(acb_t res, const acb_t x, slong target_rel_bits);
+int acb_zeta_accurate(acb_t res, const acb_t x, slong target_rel_bits);
+int acb_hurwitz_zeta_accurate(acb_t res, const acb_t s, const acb_t a,
+    slong target_rel_bits);
+
 void acb_log_barnes_g(acb_t res, const acb_t z, slong prec);
 void acb_barnes_g(acb_t res, const acb_t z, slong prec);
 
@@ -0,0 +1,82 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb.h"
+
+/* guard bits added to the precision for each attempt */
+#define GUARD_BITS 16
+
+int
+acb_eval_accurate(acb_t res, acb_eval_func_t func, void * param,
+    const acb_t x, slong target_rel_bits, slong max_prec)
+{
+    slong wp, acc, prev_acc, input_acc;
+    int success;
+    acb_t t;
+
+    input_acc = acb_rel_accuracy_bits(x);
+
+    /* no point in using much more precision than the input has */
+    wp = FLINT_MIN(target_rel_bits, FLINT_MAX(input_acc, 0)) + GUARD_BITS;
+    wp = FLINT_MAX(wp, 2);
+    wp = FLINT_MIN(wp, max_prec);
+
+    acb_init(t);
+    prev_acc = -ARF_PREC_EXACT;
+    success = 0;
+
+    for (;;)
+    {
+        func(t, x, param, wp);
+        acc = acb_rel_accuracy_bits(t);
+
+        if (acc >= target_rel_bits)
+        {
+            success = 1;
+            break;
+        }
+
+        /* give up if the precision is exhausted or if increasing
+           the precision did not help (the input is too imprecise) */
+        if (wp >= max_prec || (acc <= prev_acc && wp > input_acc))
+            break;
+
+        prev_acc = acc;
+
+        /* if the result has some accuracy, assume that the number of
+           lost bits stays the same; otherwise double the precision */
+        if (acc > 0)
+            wp += (target_rel_bits - acc) + GUARD_BITS;
+        else
+            wp *= 2;
+
+        wp = FLINT_MIN(wp, max_prec);
+    }
+
+    acb_swap(res, t);
+    acb_clear(t);
+
+    return success;
+}
@@ -0,0 +1,111 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb.h"
+
+void
+acb_exp_arith_progression(acb_ptr res, const acb_t a, const acb_t d,
+    slong n, slong prec)
+{
+    slong i, j, len, wp;
+    acb_ptr dpow;
+    acb_t am, dm, t, u;
+    mag_t ra, rd, r, err;
+
+    if (n <= 0)
+        return;
+
+    if (n == 1)
+    {
+        acb_exp(res, a, prec);
+        return;
+    }
+
+    /* direct evaluations at every len-th point, multiplication
+       by a table of powers of exp(d) in between */
+    len = FLINT_MIN(n, 4 * n_sqrt(n));
+    wp = prec + 2 * FLINT_BIT_COUNT(len) + 4;
+
+    dpow = _acb_vec_init(len);
+    acb_init(am);
+    acb_init(dm);
+    acb_init(t);
+    acb_init(u);
+    mag_init(ra);
+    mag_init(rd);
+    mag_init(r);
+    mag_init(err);
+
+    /* work with the exact midpoints, and add the propagated error
+       |exp(a + k d)| (exp(|rad(a)| + k |rad(d)|) - 1) at the end */
+    arb_get_mid_arb(acb_realref(am), acb_realref(a));
+    arb_get_mid_arb(acb_imagref(am), acb_imagref(a));
+    arb_get_mid_arb(acb_realref(dm), acb_realref(d));
+    arb_get_mid_arb(acb_imagref(dm), acb_imagref(d));
+
+    acb_exp(t, dm, wp);
+    _acb_vec_set_powers(dpow, t, len, wp);
+
+    for (j = 0; j < n; j += len)
+    {
+        acb_mul_si(u, dm, j, wp);
+        acb_add(u, u, am, wp);
+        acb_exp(t, u, wp);
+
+        for (i = 0; i < len && j + i < n; i++)
+        {
+            if (i == 0)
+                acb_set_round(res + j, t, prec);
+            else
+                acb_mul(res + j + i, t, dpow + i, prec);
+        }
+    }
+
+    if (!acb_is_exact(a) || !acb_is_exact(d))
+    {
+        mag_add(ra, arb_radref(acb_realref(a)), arb_radref(acb_imagref(a)));
+        mag_add(rd, arb_radref(acb_realref(d)), arb_radref(acb_imagref(d)));
+
+        for (i = 0; i < n; i++)
+        {
+            mag_mul_ui(r, rd, i);
+            mag_add(r, r, ra);
+            mag_expm1(r, r);
+            acb_get_mag(err, res + i);
+            mag_mul(err, err, r);
+            acb_add_error_mag(res + i, err);
+        }
+    }
+
+    _acb_vec_clear(dpow, len);
+    acb_clear(am);
+    acb_clear(dm);
+    acb_clear(t);
+    acb_clear(u);
+    mag_clear(ra);
+    mag_clear(rd);
+    mag_clear(r);
+    mag_clear(err);
+}
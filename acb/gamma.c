@@ -39,6 +39,7 @@ acb_gamma_stirling_eval(acb_t s, const acb_t z, slong nterms, int digamma, slong
 {
     acb_t t, logz, zinv, zinv2;
     arb_t b;
+    arb_srcptr coeffs;
     mag_t err;
 
     slong k, term_prec;
@@ -60,6 +61,8 @@ acb_gamma_stirling_eval(acb_t s, const acb_t z, slong nterms, int digamma, slong
     {
         acb_mul(zinv2, zinv, zinv, prec);
 
+        coeffs = _arb_gamma_stirling_coeffs_cached(nterms, digamma, prec);
+
         z_mag = arf_get_d(arb_midref(acb_realref(logz)), ARF_RND_UP) * 1.44269504088896;
 
         for (k = nterms - 1; k >= 1; k--)
@@ -70,7 +73,8 @@ acb_gamma_stirling_eval(acb_t s, const acb_t z, slong nterms, int digamma, slong
             term_prec = FLINT_MIN(term_prec, prec);
             term_prec = FLINT_MAX(term_prec, 10);
 
-            arb_gamma_stirling_coeff(b, k, digamma, term_prec);
+            if (coeffs == NULL)
+                arb_gamma_stirling_coeff(b, k, digamma, term_prec);
 
             if (prec > 2000)
             {
@@ -80,7 +84,8 @@ acb_gamma_stirling_eval(acb_t s, const acb_t z, slong nterms, int digamma, slong
             else
                 acb_mul(s, s, zinv2, term_prec);
 
-            arb_add(acb_realref(s), acb_realref(s), b, term_prec);
+            arb_add(acb_realref(s), acb_realref(s),
+                (coeffs != NULL) ? coeffs + k : b, term_prec);
         }
 
         if (digamma)
@@ -0,0 +1,39 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb.h"
+
+static void
+_acb_gamma_func(acb_t res, const acb_t x, void * param, slong prec)
+{
+    acb_gamma(res, x, prec);
+}
+
+int
+acb_gamma_accurate(acb_t res, const acb_t x, slong target_rel_bits)
+{
+    return acb_eval_accurate(res, _acb_gamma_func, NULL, x,
+        target_rel_bits, ARB_ACCURATE_MAX_PREC(target_rel_bits));
+}
@@ -0,0 +1,365 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include <pthread.h>
+#include "acb_poly.h"
+#include "bernoulli.h"
+
+typedef struct
+{
+    acb_ptr pw;
+    arb_srcptr logs;
+    const ulong * spf;
+    acb_srcptr s;
+    ulong n0;
+    ulong n1;
+    slong prec;
+}
+prime_pow_arg_t;
+
+/* pw[p] = p^(-s) for primes n0 <= p < n1 */
+static void
+prime_pow(prime_pow_arg_t arg)
+{
+    ulong p;
+
+    for (p = arg.n0; p < arg.n1; p++)
+    {
+        if (arg.spf[p] == 0)
+        {
+            acb_mul_arb(arg.pw + p, arg.s, arg.logs + p, arg.prec);
+            acb_neg(arg.pw + p, arg.pw + p);
+            acb_exp(arg.pw + p, arg.pw + p, arg.prec);
+        }
+    }
+}
+
+static void *
+prime_pow_worker(void * arg_ptr)
+{
+    prime_pow(*((prime_pow_arg_t *) arg_ptr));
+    flint_cleanup();
+    return NULL;
+}
+
+typedef struct
+{
+    acb_ptr res;
+    acb_srcptr pw;
+    acb_srcptr c;
+    acb_srcptr s;
+    acb_srcptr ns;
+    acb_srcptr qs;
+    acb_srcptr sinv;
+    ulong q;
+    ulong N;
+    ulong M;
+    ulong j0;
+    ulong j1;
+    slong prec;
+}
+shift_arg_t;
+
+/* res[j-1] = zeta(s, j/q) for j0 <= j < j1 */
+static void
+shift(shift_arg_t arg)
+{
+    acb_t a, Na, w, x, h, u;
+    arb_ptr vb;
+    mag_t bound;
+    ulong j, k;
+    slong r, prec = arg.prec;
+    int is_real;
+
+    acb_init(a);
+    acb_init(Na);
+    acb_init(w);
+    acb_init(x);
+    acb_init(h);
+    acb_init(u);
+    vb = _arb_vec_init(1);
+    mag_init(bound);
+
+    is_real = acb_is_real(arg.s);
+
+    for (j = arg.j0; j < arg.j1; j++)
+    {
+        acb_ptr z = arg.res + j - 1;
+
+        /* sum_{k<N} (k+j/q)^(-s) = q^s sum_{k<N} (kq+j)^(-s) */
+        acb_zero(z);
+        for (k = 0; k < arg.N; k++)
+            acb_add(z, z, arg.pw + k * arg.q + j, prec);
+        acb_mul(z, z, arg.qs, prec);
+
+        acb_set_ui(a, j);
+        acb_div_ui(a, a, arg.q, prec);
+        acb_add_ui(Na, a, arg.N, prec);
+
+        /* w = (N+a)^(-s) */
+        acb_pow(w, Na, arg.ns, prec);
+
+        /* (N+a)^(1-s) / (s-1) + (N+a)^(-s) / 2 */
+        acb_mul(u, w, Na, prec);
+        acb_addmul(z, u, arg.sinv, prec);
+        acb_mul_2exp_si(u, w, -1);
+        acb_add(z, z, u, prec);
+
+        /* (N+a)^(-s) sum_{r=1}^M c_r (N+a)^(1-2r), by Horner's rule
+           in 1/(N+a)^2 */
+        if (arg.M > 0)
+        {
+            acb_mul(x, Na, Na, prec);
+            acb_inv(x, x, prec);
+
+            acb_set(h, arg.c + arg.M - 1);
+            for (r = arg.M - 2; r >= 0; r--)
+            {
+                acb_mul(h, h, x, prec);
+                acb_add(h, h, arg.c + r, prec);
+            }
+
+            acb_div(h, h, Na, prec);
+            acb_addmul(z, h, w, prec);
+        }
+
+        _acb_poly_zeta_em_bound(vb, arg.s, a, arg.N, arg.M, 1, MAG_BITS);
+        arb_get_mag(bound, vb);
+        arb_add_error_mag(acb_realref(z), bound);
+        if (!is_real)
+            arb_add_error_mag(acb_imagref(z), bound);
+    }
+
+    acb_clear(a);
+    acb_clear(Na);
+    acb_clear(w);
+    acb_clear(x);
+    acb_clear(h);
+    acb_clear(u);
+    _arb_vec_clear(vb, 1);
+    mag_clear(bound);
+}
+
+static void *
+shift_worker(void * arg_ptr)
+{
+    shift(*((shift_arg_t *) arg_ptr));
+    flint_cleanup();
+    return NULL;
+}
+
+void
+acb_hurwitz_zeta_vec_rational(acb_ptr res, const acb_t s, ulong q, slong prec)
+{
+    pthread_t * threads;
+    prime_pow_arg_t * pargs;
+    shift_arg_t * sargs;
+    acb_ptr pw, c;
+    arb_ptr logs;
+    ulong * spf;
+    ulong N, M, N2, M2, L, p, m, j;
+    slong i, r, wp, num_threads;
+    acb_t a, ns, qs, sinv, t;
+    arb_t b;
+    mag_t bound, tol;
+
+    if (q == 0)
+        return;
+
+    if (!acb_is_finite(s))
+    {
+        for (j = 0; j < q; j++)
+            acb_indeterminate(res + j);
+        return;
+    }
+
+    acb_init(a);
+    mag_init(bound);
+    mag_init(tol);
+
+    /* one choice of N, M for all shifts: the bound is largest at the
+       ends of the interval (0, 1] */
+    mag_one(tol);
+    mag_mul_2exp_si(tol, tol, -prec);
+
+    acb_one(a);
+    acb_div_ui(a, a, q, MAG_BITS);
+    _acb_poly_zeta_em_choose_param(bound, &N, &M, s, a, 1, prec, MAG_BITS);
+
+    acb_one(a);
+    _acb_poly_zeta_em_bound1(bound, s, a, N, M, 1, MAG_BITS);
+    if (mag_cmp(bound, tol) > 0)
+    {
+        _acb_poly_zeta_em_choose_param(bound, &N2, &M2, s, a, 1, prec, MAG_BITS);
+        N = FLINT_MAX(N, N2);
+        M = FLINT_MAX(M, M2);
+    }
+
+    L = N * q;
+    wp = prec + FLINT_BIT_COUNT(L) + 6;
+
+    acb_init(ns);
+    acb_init(qs);
+    acb_init(sinv);
+    acb_init(t);
+    arb_init(b);
+
+    /* the s-dependent factors of the Euler-Maclaurin tail, shared by all
+       shifts: c_r = B_{2r} / (2r)! * s (s+1) ... (s+2r-2) */
+    BERNOULLI_ENSURE_CACHED(2 * M);
+
+    c = _acb_vec_init(FLINT_MAX(M, 1));
+    acb_mul_2exp_si(t, s, -1);
+    for (r = 1; r <= M; r++)
+    {
+        if (r > 1)
+        {
+            acb_add_ui(ns, s, 2 * r - 3, wp);
+            acb_mul(t, t, ns, wp);
+            acb_add_ui(ns, s, 2 * r - 2, wp);
+            acb_mul(t, t, ns, wp);
+            acb_div_ui(t, t, (2 * r - 1) * (2 * r), wp);
+        }
+
+        arb_set_round_fmpz(b, fmpq_numref(bernoulli_cache + 2 * r), wp);
+        arb_div_fmpz(b, b, fmpq_denref(bernoulli_cache + 2 * r), wp);
+        acb_mul_arb(c + r - 1, t, b, wp);
+    }
+
+    acb_neg(ns, s);
+    acb_set_ui(qs, q);
+    acb_pow(qs, qs, s, wp);
+    acb_sub_ui(sinv, s, 1, wp);
+    acb_inv(sinv, sinv, wp);
+
+    /* n^(-s) for all n <= Nq: the terms (kq+j)^(-s) of all the power
+       sums together run over each such n once; only the primes need
+       an exponential, using a shared vector of logarithms */
+    logs = _arb_vec_init(L + 1);
+    arb_log_ui_vec(logs, L + 1, wp);
+
+    spf = flint_calloc(L + 1, sizeof(ulong));
+    for (p = 2; p * p <= L; p++)
+        if (spf[p] == 0)
+            for (m = p * p; m <= L; m += p)
+                if (spf[m] == 0)
+                    spf[m] = p;
+
+    pw = _acb_vec_init(L + 1);
+    acb_one(pw + 1);
+
+    num_threads = flint_get_num_threads();
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, L / 64));
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    pargs = flint_malloc(sizeof(prime_pow_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        pargs[i].pw = pw;
+        pargs[i].logs = logs;
+        pargs[i].spf = spf;
+        pargs[i].s = s;
+        pargs[i].n0 = 2 + ((L - 1) * i) / num_threads;
+        pargs[i].n1 = 2 + ((L - 1) * (i + 1)) / num_threads;
+        pargs[i].prec = wp;
+    }
+
+    if (num_threads == 1)
+    {
+        prime_pow(pargs[0]);
+    }
+    else
+    {
+        for (i = 0; i < num_threads; i++)
+            pthread_create(&threads[i], NULL, prime_pow_worker, &pargs[i]);
+
+        for (i = 0; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+    }
+
+    /* composites by complete multiplicativity */
+    for (m = 4; m <= L; m++)
+        if (spf[m] != 0)
+            acb_mul(pw + m, pw + spf[m], pw + m / spf[m], wp);
+
+    flint_free(pargs);
+    flint_free(threads);
+
+    num_threads = flint_get_num_threads();
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, q));
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    sargs = flint_malloc(sizeof(shift_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        sargs[i].res = res;
+        sargs[i].pw = pw;
+        sargs[i].c = c;
+        sargs[i].s = s;
+        sargs[i].ns = ns;
+        sargs[i].qs = qs;
+        sargs[i].sinv = sinv;
+        sargs[i].q = q;
+        sargs[i].N = N;
+        sargs[i].M = M;
+        sargs[i].j0 = 1 + (q * i) / num_threads;
+        sargs[i].j1 = 1 + (q * (i + 1)) / num_threads;
+        sargs[i].prec = wp;
+    }
+
+    if (num_threads == 1)
+    {
+        shift(sargs[0]);
+    }
+    else
+    {
+        for (i = 0; i < num_threads; i++)
+            pthread_create(&threads[i], NULL, shift_worker, &sargs[i]);
+
+        for (i = 0; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+    }
+
+    for (j = 0; j < q; j++)
+        acb_set_round(res + j, res + j, prec);
+
+    flint_free(sargs);
+    flint_free(threads);
+    _acb_vec_clear(pw, L + 1);
+    _arb_vec_clear(logs, L + 1);
+    _acb_vec_clear(c, FLINT_MAX(M, 1));
+    flint_free(spf);
+    acb_clear(a);
+    acb_clear(ns);
+    acb_clear(qs);
+    acb_clear(sinv);
+    acb_clear(t);
+    arb_clear(b);
+    mag_clear(bound);
+    mag_clear(tol);
+}
+
@@ -0,0 +1,108 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("eval_accurate....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000; iter++)
+    {
+        acb_t s, a, y, z;
+        slong target, acc;
+        int success, hurwitz;
+
+        acb_init(s);
+        acb_init(a);
+        acb_init(y);
+        acb_init(z);
+
+        target = 2 + n_randint(state, 200);
+        hurwitz = n_randint(state, 2);
+
+        acb_randtest(s, state, 1 + n_randint(state, 300), 3);
+        if (n_randint(state, 2))
+        {
+            arb_get_mid_arb(acb_realref(s), acb_realref(s));
+            arb_get_mid_arb(acb_imagref(s), acb_imagref(s));
+        }
+
+        arb_randtest_precise(acb_realref(a), state, 1 + n_randint(state, 300), 3);
+        arb_abs(acb_realref(a), acb_realref(a));
+        arb_add_ui(acb_realref(a), acb_realref(a), 1, 300);
+
+        if (hurwitz)
+        {
+            success = acb_hurwitz_zeta_accurate(y, s, a, target);
+            acb_hurwitz_zeta(z, s, a, target + 100);
+        }
+        else
+        {
+            success = acb_zeta_accurate(y, s, target);
+            acb_zeta(z, s, target + 100);
+        }
+
+        acc = acb_rel_accuracy_bits(y);
+
+        if (!acb_overlaps(y, z) || (success && acc < target))
+        {
+            flint_printf("FAIL: overlap or accuracy\n\n");
+            flint_printf("target = %wd, acc = %wd\n\n", target, acc);
+            flint_printf("s = "); acb_printd(s, 30); flint_printf("\n\n");
+            flint_printf("a = "); acb_printd(a, 30); flint_printf("\n\n");
+            flint_printf("y = "); acb_printd(y, 30); flint_printf("\n\n");
+            flint_printf("z = "); acb_printd(z, 30); flint_printf("\n\n");
+            abort();
+        }
+
+        /* zeta(s) is close to 1 when re(s) >= 2 */
+        if (!success && !hurwitz && acb_is_exact(s)
+            && arf_cmp_2exp_si(arb_midref(acb_realref(s)), 1) >= 0)
+        {
+            flint_printf("FAIL: success\n\n");
+            flint_printf("target = %wd, acc = %wd\n\n", target, acc);
+            flint_printf("s = "); acb_printd(s, 30); flint_printf("\n\n");
+            flint_printf("y = "); acb_printd(y, 30); flint_printf("\n\n");
+            abort();
+        }
+
+        acb_clear(s);
+        acb_clear(a);
+        acb_clear(y);
+        acb_clear(z);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,108 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("exp_arith_progression....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000; iter++)
+    {
+        acb_ptr res;
+        acb_t a, d, x, y;
+        slong k, n, prec, acc;
+
+        n = n_randint(state, 200);
+        prec = 2 + n_randint(state, 500);
+
+        res = _acb_vec_init(n);
+        acb_init(a);
+        acb_init(d);
+        acb_init(x);
+        acb_init(y);
+
+        acb_randtest(a, state, 1 + n_randint(state, 500), 3);
+        acb_randtest(d, state, 1 + n_randint(state, 500), 3);
+
+        if (n_randint(state, 2))
+        {
+            arb_get_mid_arb(acb_realref(a), acb_realref(a));
+            arb_get_mid_arb(acb_imagref(a), acb_imagref(a));
+            arb_get_mid_arb(acb_realref(d), acb_realref(d));
+            arb_get_mid_arb(acb_imagref(d), acb_imagref(d));
+        }
+
+        acb_exp_arith_progression(res, a, d, n, prec);
+
+        for (k = 0; k < n; k++)
+        {
+            acb_mul_si(x, d, k, prec + 100);
+            acb_add(x, x, a, prec + 100);
+            acb_exp(y, x, prec + 100);
+
+            if (!acb_overlaps(res + k, y))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("n = %wd, k = %wd, prec = %wd\n\n", n, k, prec);
+                flint_printf("a = "); acb_printd(a, 30); flint_printf("\n\n");
+                flint_printf("d = "); acb_printd(d, 30); flint_printf("\n\n");
+                flint_printf("res = "); acb_printd(res + k, 30); flint_printf("\n\n");
+                flint_printf("y = "); acb_printd(y, 30); flint_printf("\n\n");
+                abort();
+            }
+
+            acc = acb_rel_accuracy_bits(res + k);
+
+            if (acb_is_exact(a) && acb_is_exact(d) && acc < prec - 6)
+            {
+                flint_printf("FAIL: accuracy\n\n");
+                flint_printf("n = %wd, k = %wd, prec = %wd, acc = %wd\n\n",
+                    n, k, prec, acc);
+                flint_printf("a = "); acb_printd(a, 30); flint_printf("\n\n");
+                flint_printf("d = "); acb_printd(d, 30); flint_printf("\n\n");
+                flint_printf("res = "); acb_printd(res + k, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _acb_vec_clear(res, n);
+        acb_clear(a);
+        acb_clear(d);
+        acb_clear(x);
+        acb_clear(y);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
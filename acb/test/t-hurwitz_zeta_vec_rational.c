@@ -0,0 +1,101 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("hurwitz_zeta_vec_rational....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 500; iter++)
+    {
+        acb_ptr z;
+        acb_t s, a, t;
+        ulong q, k;
+        slong prec;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        prec = 2 + n_randint(state, 200);
+        q = 1 + n_randint(state, 30);
+
+        z = _acb_vec_init(q);
+        acb_init(s);
+        acb_init(a);
+        acb_init(t);
+
+        switch (n_randint(state, 3))
+        {
+            case 0:
+                acb_set_si(s, n_randint(state, 20) - 10);
+                if (acb_is_one(s))
+                    acb_set_si(s, 2);
+                break;
+            case 1:
+                arb_set_ui(acb_realref(s), 1);
+                arb_mul_2exp_si(acb_realref(s), acb_realref(s), -1);
+                arb_randtest(acb_imagref(s), state, 1 + n_randint(state, 200), 6);
+                break;
+            default:
+                acb_randtest(s, state, 1 + n_randint(state, 200), 4);
+        }
+
+        acb_hurwitz_zeta_vec_rational(z, s, q, prec);
+
+        for (k = 1; k <= q; k++)
+        {
+            acb_set_ui(a, k);
+            acb_div_ui(a, a, q, prec + 20);
+            acb_hurwitz_zeta(t, s, a, prec);
+
+            if (!acb_overlaps(z + k - 1, t))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("iter = %wd, q = %wu, k = %wu, prec = %wd\n\n", iter, q, k, prec);
+                flint_printf("s = "); acb_printd(s, 15); flint_printf("\n\n");
+                flint_printf("z = "); acb_printd(z + k - 1, 15); flint_printf("\n\n");
+                flint_printf("t = "); acb_printd(t, 15); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _acb_vec_clear(z, q);
+        acb_clear(s);
+        acb_clear(a);
+        acb_clear(t);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -106,6 +106,42 @@ int main()
         acb_clear(y);
     }
 
+    /* threaded splitting must give the same result as serial */
+    for (iter = 0; iter < 100; iter++)
+    {
+        acb_t x, y, z;
+        ulong n;
+        slong prec;
+
+        acb_init(x);
+        acb_init(y);
+        acb_init(z);
+
+        acb_randtest(x, state, 1 + n_randint(state, 2000), 10);
+        n = n_randint(state, 2000);
+        prec = 2 + n_randint(state, 2000);
+
+        flint_set_num_threads(1);
+        acb_rising_ui_bs(y, x, n, prec);
+        flint_set_num_threads(1 + n_randint(state, 4));
+        acb_rising_ui_bs(z, x, n, prec);
+
+        if (!acb_equal(y, z))
+        {
+            flint_printf("FAIL: threads\n\n");
+            flint_printf("n = %wu, prec = %wd\n", n, prec);
+            flint_printf("x = "); acb_printd(x, 30); flint_printf("\n\n");
+            flint_printf("y = "); acb_printd(y, 30); flint_printf("\n\n");
+            flint_printf("z = "); acb_printd(z, 30); flint_printf("\n\n");
+            abort();
+        }
+
+        acb_clear(x);
+        acb_clear(y);
+        acb_clear(z);
+    }
+
+    flint_set_num_threads(1);
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
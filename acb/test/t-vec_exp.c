@@ -0,0 +1,125 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+#include "acb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("vec_exp....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000; iter++)
+    {
+        acb_ptr x, y, z, w;
+        slong i, len, prec;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        len = n_randint(state, 150);
+        prec = 2 + n_randint(state, 2000);
+
+        x = _acb_vec_init(len);
+        y = _acb_vec_init(len);
+        z = _acb_vec_init(len);
+        w = _acb_vec_init(len);
+
+        /* generic points mixed with real and imaginary ones */
+        for (i = 0; i < len; i++)
+        {
+            acb_randtest(x + i, state, 1 + n_randint(state, 1000), 4);
+
+            switch (n_randint(state, 6))
+            {
+                case 0: arb_zero(acb_imagref(x + i)); break;
+                case 1: arb_zero(acb_realref(x + i)); break;
+                case 2: acb_randtest_special(x + i, state, 1 + n_randint(state, 1000), 8); break;
+                default: break;
+            }
+        }
+
+        _acb_vec_exp(y, x, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            acb_exp(z + i, x + i, prec);
+
+            if (!acb_overlaps(y + i, z + i))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                flint_printf("x = "); acb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("y = "); acb_printd(y + i, 30); flint_printf("\n\n");
+                flint_printf("z = "); acb_printd(z + i, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        /* exp(x) exp(-x) = 1 */
+        _acb_vec_neg(w, x, len);
+        _acb_vec_exp(w, w, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            acb_mul(z + i, y + i, w + i, prec);
+
+            if (acb_is_finite(z + i) && !(arb_contains_si(acb_realref(z + i), 1)
+                    && arb_contains_zero(acb_imagref(z + i))))
+            {
+                flint_printf("FAIL: functional equation\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                flint_printf("x = "); acb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("z = "); acb_printd(z + i, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _acb_vec_exp(x, x, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            if (!acb_overlaps(x + i, y + i))
+            {
+                flint_printf("FAIL: aliasing\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                abort();
+            }
+        }
+
+        _acb_vec_clear(x, len);
+        _acb_vec_clear(y, len);
+        _acb_vec_clear(z, len);
+        _acb_vec_clear(w, len);
+    }
+
+    flint_set_num_threads(1);
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,116 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+#include "acb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("vec_lgamma....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000; iter++)
+    {
+        acb_ptr x, y;
+        acb_t t, u;
+        slong i, len, prec;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        len = n_randint(state, 100);
+        prec = 2 + n_randint(state, 300);
+
+        x = _acb_vec_init(len);
+        y = _acb_vec_init(len);
+        acb_init(t);
+        acb_init(u);
+
+        /* arguments on both sides of the reflection cutoff */
+        for (i = 0; i < len; i++)
+        {
+            acb_randtest(x + i, state, 1 + n_randint(state, 300), 3);
+
+            if (n_randint(state, 4) == 0)
+                arb_neg(acb_realref(x + i), acb_realref(x + i));
+        }
+
+        _acb_vec_lgamma(y, x, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            acb_lgamma(t, x + i, prec);
+
+            if (!acb_overlaps(y + i, t))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("len = %wd, i = %wd, prec = %wd\n\n", len, i, prec);
+                flint_printf("x = "); acb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("y = "); acb_printd(y + i, 30); flint_printf("\n\n");
+                flint_printf("t = "); acb_printd(t, 30); flint_printf("\n\n");
+                abort();
+            }
+
+            /* exp(lgamma(x)) = gamma(x) */
+            acb_exp(t, y + i, prec);
+            acb_gamma(u, x + i, prec);
+
+            if (!acb_overlaps(t, u))
+            {
+                flint_printf("FAIL: gamma\n\n");
+                flint_printf("len = %wd, i = %wd, prec = %wd\n\n", len, i, prec);
+                flint_printf("x = "); acb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("t = "); acb_printd(t, 30); flint_printf("\n\n");
+                flint_printf("u = "); acb_printd(u, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _acb_vec_lgamma(x, x, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            if (!acb_overlaps(x + i, y + i))
+            {
+                flint_printf("FAIL: aliasing\n\n");
+                flint_printf("len = %wd, i = %wd, prec = %wd\n\n", len, i, prec);
+                abort();
+            }
+        }
+
+        _acb_vec_clear(x, len);
+        _acb_vec_clear(y, len);
+        acb_clear(t);
+        acb_clear(u);
+    }
+
+    flint_set_num_threads(1);
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,127 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+#include "acb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("vec_log....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000; iter++)
+    {
+        acb_ptr x, y, z;
+        acb_t t;
+        slong i, len, prec;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        len = n_randint(state, 150);
+        prec = 2 + n_randint(state, 2000);
+
+        x = _acb_vec_init(len);
+        y = _acb_vec_init(len);
+        z = _acb_vec_init(len);
+        acb_init(t);
+
+        /* generic points, points close to 1, and points on the axes */
+        for (i = 0; i < len; i++)
+        {
+            switch (n_randint(state, 6))
+            {
+                case 0:
+                    acb_randtest(t, state, 1 + n_randint(state, 1000), 3);
+                    acb_mul_2exp_si(t, t, -(slong) n_randint(state, 100));
+                    acb_add_ui(x + i, t, 1, 1000);
+                    break;
+                case 1:
+                    acb_randtest(x + i, state, 1 + n_randint(state, 1000), 10);
+                    arb_zero(acb_imagref(x + i));
+                    break;
+                case 2:
+                    acb_randtest_special(x + i, state, 1 + n_randint(state, 1000), 10);
+                    break;
+                default:
+                    acb_randtest(x + i, state, 1 + n_randint(state, 1000), 10);
+            }
+        }
+
+        _acb_vec_log(y, x, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            acb_log(z + i, x + i, prec);
+
+            if (!acb_overlaps(y + i, z + i))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                flint_printf("x = "); acb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("y = "); acb_printd(y + i, 30); flint_printf("\n\n");
+                flint_printf("z = "); acb_printd(z + i, 30); flint_printf("\n\n");
+                abort();
+            }
+
+            /* exp(log(x)) = x */
+            acb_exp(t, y + i, prec);
+
+            if (acb_is_finite(t) && !acb_overlaps(t, x + i))
+            {
+                flint_printf("FAIL: functional equation\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                flint_printf("x = "); acb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("t = "); acb_printd(t, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _acb_vec_log(x, x, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            if (!acb_overlaps(x + i, y + i))
+            {
+                flint_printf("FAIL: aliasing\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                abort();
+            }
+        }
+
+        _acb_vec_clear(x, len);
+        _acb_vec_clear(y, len);
+        _acb_vec_clear(z, len);
+        acb_clear(t);
+    }
+
+    flint_set_num_threads(1);
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,144 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+#include "acb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("vec_sin_cos....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000; iter++)
+    {
+        acb_ptr x, s, c, s2, c2;
+        acb_t t, u;
+        slong i, len, prec;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        len = n_randint(state, 150);
+        prec = 2 + n_randint(state, 2000);
+
+        x = _acb_vec_init(len);
+        s = _acb_vec_init(len);
+        c = _acb_vec_init(len);
+        s2 = _acb_vec_init(len);
+        c2 = _acb_vec_init(len);
+        acb_init(t);
+        acb_init(u);
+
+        /* include imaginary parts on both sides of the sinh/cosh cutoff */
+        for (i = 0; i < len; i++)
+        {
+            acb_randtest(x + i, state, 1 + n_randint(state, 1000), 4);
+
+            switch (n_randint(state, 5))
+            {
+                case 0: arb_mul_2exp_si(acb_imagref(x + i), acb_imagref(x + i), -10); break;
+                case 1: arb_zero(acb_imagref(x + i)); break;
+                case 2: acb_randtest_special(x + i, state, 1 + n_randint(state, 1000), 6); break;
+                default: break;
+            }
+        }
+
+        _acb_vec_sin_cos(s, c, x, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            acb_sin_cos(t, u, x + i, prec);
+
+            if (!acb_overlaps(s + i, t) || !acb_overlaps(c + i, u))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                flint_printf("x = "); acb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("s = "); acb_printd(s + i, 30); flint_printf("\n\n");
+                flint_printf("c = "); acb_printd(c + i, 30); flint_printf("\n\n");
+                flint_printf("t = "); acb_printd(t, 30); flint_printf("\n\n");
+                flint_printf("u = "); acb_printd(u, 30); flint_printf("\n\n");
+                abort();
+            }
+
+            /* sin(x)^2 + cos(x)^2 = 1 */
+            acb_mul(t, s + i, s + i, prec);
+            acb_addmul(t, c + i, c + i, prec);
+
+            if (acb_is_finite(t) && !(arb_contains_si(acb_realref(t), 1)
+                    && arb_contains_zero(acb_imagref(t))))
+            {
+                flint_printf("FAIL: functional equation\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                flint_printf("x = "); acb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("t = "); acb_printd(t, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _acb_vec_sin_cos(s2, NULL, x, len, prec);
+        _acb_vec_sin_cos(NULL, c2, x, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            if (!acb_overlaps(s + i, s2 + i) || !acb_overlaps(c + i, c2 + i))
+            {
+                flint_printf("FAIL: single output\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                flint_printf("x = "); acb_printd(x + i, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _acb_vec_set(c2, x, len);
+        _acb_vec_sin_cos(x, c2, x, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            if (!acb_overlaps(x + i, s + i) || !acb_overlaps(c2 + i, c + i))
+            {
+                flint_printf("FAIL: aliasing\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                abort();
+            }
+        }
+
+        _acb_vec_clear(x, len);
+        _acb_vec_clear(s, len);
+        _acb_vec_clear(c, len);
+        _acb_vec_clear(s2, len);
+        _acb_vec_clear(c2, len);
+        acb_clear(t);
+        acb_clear(u);
+    }
+
+    flint_set_num_threads(1);
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
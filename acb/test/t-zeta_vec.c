@@ -0,0 +1,98 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("zeta_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000; iter++)
+    {
+        acb_ptr s, z1, z2;
+        slong j, num, prec;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        prec = 2 + n_randint(state, 200);
+        num = n_randint(state, 8);
+
+        s = _acb_vec_init(num);
+        z1 = _acb_vec_init(num);
+        z2 = _acb_vec_init(num);
+
+        for (j = 0; j < num; j++)
+        {
+            switch (n_randint(state, 4))
+            {
+                case 0:
+                    acb_set_si(s + j, n_randint(state, 20) - 10);
+                    break;
+                case 1:
+                    arb_set_ui(acb_realref(s + j), 1);
+                    arb_mul_2exp_si(acb_realref(s + j), acb_realref(s + j), -1);
+                    arb_randtest(acb_imagref(s + j), state, 1 + n_randint(state, 200), 6);
+                    break;
+                default:
+                    acb_randtest(s + j, state, 1 + n_randint(state, 200), 4);
+            }
+        }
+
+        acb_zeta_vec(z1, s, num, prec);
+
+        for (j = 0; j < num; j++)
+        {
+            acb_zeta(z2 + j, s + j, prec);
+
+            if (!acb_overlaps(z1 + j, z2 + j))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("iter = %wd\n", iter);
+                flint_printf("num = %wd, j = %wd, prec = %wd\n\n", num, j, prec);
+                flint_printf("s = "); acb_printd(s + j, 15); flint_printf("\n\n");
+                flint_printf("z1 = "); acb_printd(z1 + j, 15); flint_printf("\n\n");
+                flint_printf("z2 = "); acb_printd(z2 + j, 15); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _acb_vec_clear(s, num);
+        _acb_vec_clear(z1, num);
+        _acb_vec_clear(z2, num);
+    }
+
+    flint_set_num_threads(1);
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,103 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+#include "acb.h"
+
+void
+_acb_vec_exp(acb_ptr res, acb_srcptr x, slong len, slong prec)
+{
+    arb_ptr a, b, e, s, c;
+    slong * ia, * ib;
+    slong i, j, k, na, nb;
+    int has_a, has_b;
+
+    if (len == 0)
+        return;
+
+    /* shallow copies of the nonzero real and imaginary parts */
+    a = flint_malloc(sizeof(arb_struct) * 2 * len);
+    b = a + len;
+    ia = flint_malloc(sizeof(slong) * 2 * len);
+    ib = ia + len;
+
+    na = nb = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        if (!arb_is_zero(acb_realref(x + i)))
+        {
+            a[na] = *acb_realref(x + i);
+            ia[na++] = i;
+        }
+
+        if (!arb_is_zero(acb_imagref(x + i)))
+        {
+            b[nb] = *acb_imagref(x + i);
+            ib[nb++] = i;
+        }
+    }
+
+    e = _arb_vec_init(na);
+    s = _arb_vec_init(nb);
+    c = _arb_vec_init(nb);
+
+    /* exp(a+bi) = exp(a) (cos(b) + i sin(b)) */
+    _arb_vec_exp(e, a, na, prec);
+    _arb_vec_sin_cos(s, c, b, nb, prec);
+
+    for (i = j = k = 0; i < len; i++)
+    {
+        has_a = (j < na && ia[j] == i);
+        has_b = (k < nb && ib[k] == i);
+
+        if (has_a && has_b)
+        {
+            arb_mul(acb_realref(res + i), e + j, c + k, prec);
+            arb_mul(acb_imagref(res + i), e + j, s + k, prec);
+        }
+        else if (has_a)
+        {
+            arb_swap(acb_realref(res + i), e + j);
+            arb_zero(acb_imagref(res + i));
+        }
+        else if (has_b)
+        {
+            arb_swap(acb_realref(res + i), c + k);
+            arb_swap(acb_imagref(res + i), s + k);
+        }
+        else
+        {
+            acb_one(res + i);
+        }
+
+        j += has_a;
+        k += has_b;
+    }
+
+    _arb_vec_clear(e, na);
+    _arb_vec_clear(s, nb);
+    _arb_vec_clear(c, nb);
+    flint_free(a);
+    flint_free(ia);
+}
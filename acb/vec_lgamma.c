@@ -0,0 +1,103 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include <pthread.h>
+#include "acb.h"
+
+/* rough number of bit operations below which threading does not pay off */
+#define THREADED_CUTOFF 10000
+
+/* the Bernoulli numbers and Stirling coefficients are thread-local, and
+   each worker frees them when it exits, so every thread should get
+   enough entries to amortise building them */
+#define MIN_BLOCK_LEN 16
+
+typedef struct
+{
+    acb_ptr res;
+    acb_srcptr x;
+    slong len;
+    slong prec;
+}
+vec_lgamma_arg_t;
+
+static void
+vec_lgamma(acb_ptr res, acb_srcptr x, slong len, slong prec)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        acb_lgamma(res + i, x + i, prec);
+}
+
+static void *
+_acb_vec_lgamma_worker(void * arg_ptr)
+{
+    vec_lgamma_arg_t arg = *((vec_lgamma_arg_t *) arg_ptr);
+
+    vec_lgamma(arg.res, arg.x, arg.len, arg.prec);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+_acb_vec_lgamma(acb_ptr res, acb_srcptr x, slong len, slong prec)
+{
+    pthread_t * threads;
+    vec_lgamma_arg_t * args;
+    slong i, num_threads;
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), len / MIN_BLOCK_LEN);
+
+    if (num_threads <= 1 || len * (prec + 64) < THREADED_CUTOFF)
+    {
+        vec_lgamma(res, x, len, prec);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(vec_lgamma_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        slong a = (len * i) / num_threads;
+        slong b = (len * (i + 1)) / num_threads;
+
+        args[i].res = res + a;
+        args[i].x = x + a;
+        args[i].len = b - a;
+        args[i].prec = prec;
+
+        pthread_create(&threads[i], NULL, _acb_vec_lgamma_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
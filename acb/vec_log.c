@@ -0,0 +1,105 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+#include "acb.h"
+
+/* same test as in acb_log */
+static int
+close_to_one(const acb_t z)
+{
+    mp_limb_t top;
+
+    if (arf_abs_bound_lt_2exp_si(arb_midref(acb_imagref(z))) > -3)
+        return 0;
+
+    if (ARF_EXP(arb_midref(acb_realref(z))) == 0)
+    {
+        ARF_GET_TOP_LIMB(top, arb_midref(acb_realref(z)));
+
+        return (top >> (FLINT_BITS - 4)) == 15;
+    }
+    else if (ARF_EXP(arb_midref(acb_realref(z))) == 1)
+    {
+        ARF_GET_TOP_LIMB(top, arb_midref(acb_realref(z)));
+
+        return (top >> (FLINT_BITS - 4)) == 8;
+    }
+
+    return 0;
+}
+
+void
+_acb_vec_log(acb_ptr res, acb_srcptr x, slong len, slong prec)
+{
+    arb_ptr t, u;
+    slong * idx;
+    slong i, j, num;
+
+    if (len == 0)
+        return;
+
+    t = _arb_vec_init(len);
+    idx = flint_malloc(sizeof(slong) * len);
+    num = 0;
+
+    /* log(a+bi) = log(a^2+b^2)/2 + i arg(a+bi), with the logarithms
+       of the generic entries computed together */
+    for (i = 0; i < len; i++)
+    {
+        if (!arb_is_zero(acb_realref(x + i)) &&
+            !arb_is_zero(acb_imagref(x + i)) && !close_to_one(x + i))
+        {
+            arb_mul(t + num, acb_realref(x + i), acb_realref(x + i), prec + 8);
+            arb_addmul(t + num, acb_imagref(x + i), acb_imagref(x + i), prec + 8);
+
+            if (!arb_contains_zero(t + num) && arf_sgn(arb_midref(t + num)) > 0)
+            {
+                idx[num++] = i;
+                continue;
+            }
+        }
+
+        acb_log(res + i, x + i, prec);
+    }
+
+    u = _arb_vec_init(num);
+    _arb_vec_log(u, t, num, prec);
+
+    for (j = 0; j < num; j++)
+    {
+        i = idx[j];
+
+        /* t is no longer needed, so it can hold the argument */
+        acb_arg(t + j, x + i, prec);
+        arb_mul_2exp_si(acb_realref(res + i), u + j, -1);
+        arb_swap(acb_imagref(res + i), t + j);
+
+        if (!acb_is_finite(res + i))
+            acb_indeterminate(res + i);
+    }
+
+    _arb_vec_clear(t, len);
+    _arb_vec_clear(u, num);
+    flint_free(idx);
+}
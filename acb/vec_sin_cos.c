@@ -0,0 +1,124 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+#include "acb.h"
+
+/* Sets s, c to sinh and cosh of the entries of x (not aliased). The
+   exponentials of the entries larger than 1/2 are computed together;
+   the remaining entries need expm1 and are done with arb_sinh_cosh. */
+static void
+_arb_vec_sinh_cosh(arb_ptr s, arb_ptr c, arb_srcptr x, slong len, slong prec)
+{
+    arb_ptr y, e;
+    slong * idx;
+    slong i, j, num, wp;
+
+    wp = prec + 4;
+
+    y = flint_malloc(sizeof(arb_struct) * len);
+    idx = flint_malloc(sizeof(slong) * len);
+    num = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        if (!arb_is_zero(x + i) &&
+            arf_cmpabs_2exp_si(arb_midref(x + i), -1) > 0)
+        {
+            y[num] = x[i];
+            idx[num++] = i;
+        }
+        else
+        {
+            arb_sinh_cosh(s + i, c + i, x + i, prec);
+        }
+    }
+
+    e = _arb_vec_init(num);
+    _arb_vec_exp(e, y, num, wp);
+
+    for (j = 0; j < num; j++)
+    {
+        i = idx[j];
+
+        /* c = exp(-x) temporarily */
+        arb_inv(c + i, e + j, wp);
+        arb_sub(s + i, e + j, c + i, prec);
+        arb_add(c + i, e + j, c + i, prec);
+        arb_mul_2exp_si(s + i, s + i, -1);
+        arb_mul_2exp_si(c + i, c + i, -1);
+    }
+
+    _arb_vec_clear(e, num);
+    flint_free(y);
+    flint_free(idx);
+}
+
+void
+_acb_vec_sin_cos(acb_ptr s, acb_ptr c, acb_srcptr x, slong len, slong prec)
+{
+    arb_ptr a, b, sa, ca, sb, cb;
+    slong i;
+
+    if (len == 0)
+        return;
+
+    /* shallow copies of the real and imaginary parts */
+    a = flint_malloc(sizeof(arb_struct) * 2 * len);
+    b = a + len;
+
+    for (i = 0; i < len; i++)
+    {
+        a[i] = *acb_realref(x + i);
+        b[i] = *acb_imagref(x + i);
+    }
+
+    sa = _arb_vec_init(4 * len);
+    ca = sa + len;
+    sb = ca + len;
+    cb = sb + len;
+
+    _arb_vec_sin_cos(sa, ca, a, len, prec);
+    _arb_vec_sinh_cosh(sb, cb, b, len, prec);
+
+    /* sin(a+bi) = sin(a)cosh(b) + i cos(a)sinh(b)
+       cos(a+bi) = cos(a)cosh(b) - i sin(a)sinh(b) */
+    for (i = 0; i < len; i++)
+    {
+        if (s != NULL)
+        {
+            arb_mul(acb_realref(s + i), sa + i, cb + i, prec);
+            arb_mul(acb_imagref(s + i), sb + i, ca + i, prec);
+        }
+
+        if (c != NULL)
+        {
+            arb_mul(acb_realref(c + i), ca + i, cb + i, prec);
+            arb_mul(acb_imagref(c + i), sa + i, sb + i, prec);
+            arb_neg(acb_imagref(c + i), acb_imagref(c + i));
+        }
+    }
+
+    _arb_vec_clear(sa, 4 * len);
+    flint_free(a);
+}
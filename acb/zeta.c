@@ -71,7 +71,44 @@ acb_zeta(acb_t z, const acb_t s, slong prec)
         return;
     }
 
-    if (arf_sgn(arb_midref(acb_realref(s))) < 0)
+    /* on the critical line high up, the Riemann-Siegel formula is
+       accurate enough and needs only sqrt(t) terms */
+    if (arb_is_exact(acb_realref(s)) &&
+        arf_cmp_2exp_si(arb_midref(acb_realref(s)), -1) == 0 &&
+        arf_cmpabs_2exp_si(arb_midref(acb_imagref(s)), 13) >= 0 &&
+        arf_cmpabs_2exp_si(arb_midref(acb_imagref(s)), FLINT_BITS - 4) < 0 &&
+        2.75 * log(fabs(arf_get_d(arb_midref(acb_imagref(s)), ARF_RND_DOWN)))
+            * 1.4426950408889634 >= prec + 2)
+    {
+        arb_t t, theta, Z;
+        slong wp = prec + 6;
+        int conjugate;
+
+        arb_init(t);
+        arb_init(theta);
+        arb_init(Z);
+
+        /* zeta(1/2 - it) = conj(zeta(1/2 + it)) */
+        conjugate = arf_sgn(arb_midref(acb_imagref(s))) < 0;
+        arb_abs(t, acb_imagref(s));
+
+        /* zeta(1/2 + it) = exp(-i theta(t)) Z(t) */
+        arb_poly_riemann_siegel_z_rs(Z, t, wp);
+        _arb_poly_riemann_siegel_theta_series(theta, t, 1, 1, wp);
+        arb_sin_cos(acb_imagref(z), acb_realref(z), theta, wp);
+        if (!conjugate)
+            arb_neg(acb_imagref(z), acb_imagref(z));
+        acb_mul_arb(z, z, Z, prec);
+
+        /* N = floor(sqrt(t / (2 pi))) is not determined by a wide ball */
+        if (!arb_is_finite(Z))
+            acb_hurwitz_zeta(z, s, a, prec);
+
+        arb_clear(t);
+        arb_clear(theta);
+        arb_clear(Z);
+    }
+    else if (arf_sgn(arb_midref(acb_realref(s))) < 0)
     {
         acb_t t, u, v;
         slong wp = prec + 6;
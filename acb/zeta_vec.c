@@ -0,0 +1,124 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_poly.h"
+#include "acb_dirichlet.h"
+
+void
+acb_zeta_vec(acb_ptr res, acb_srcptr s, slong num, slong prec)
+{
+    slong * idx;
+    slong i, j, num_em, wp;
+    ulong * N;
+    ulong * M;
+    acb_ptr se, sums;
+    arb_ptr vb;
+    acb_t one, u;
+    mag_t bound;
+
+    if (num <= 0)
+        return;
+
+    idx = flint_malloc(sizeof(slong) * num);
+    num_em = 0;
+
+    /* points handled by Euler-Maclaurin summation with shared parameters;
+       the others go through acb_zeta (exact values, the reflection formula
+       and the Riemann-Siegel formula high up) */
+    for (j = 0; j < num; j++)
+    {
+        if (acb_is_finite(s + j) && !acb_is_int(s + j) &&
+            arf_sgn(arb_midref(acb_realref(s + j))) >= 0 &&
+            arf_cmpabs_2exp_si(arb_midref(acb_imagref(s + j)), 13) < 0)
+            idx[num_em++] = j;
+        else
+            acb_zeta(res + j, s + j, prec);
+    }
+
+    if (num_em == 0)
+    {
+        flint_free(idx);
+        return;
+    }
+
+    se = _acb_vec_init(num_em);
+    sums = _acb_vec_init(num_em);
+    vb = _arb_vec_init(1);
+    acb_init(one);
+    acb_init(u);
+    mag_init(bound);
+    N = flint_malloc(sizeof(ulong) * num_em);
+    M = flint_malloc(sizeof(ulong) * num_em);
+
+    for (i = 0; i < num_em; i++)
+        acb_set(se + i, s + idx[i]);
+
+    acb_one(one);
+
+    /* each point gets its own parameters, so that points close to the
+       real axis do not pay for a large N needed higher up */
+    for (i = 0; i < num_em; i++)
+        _acb_poly_zeta_em_choose_param(bound, N + i, M + i, se + i, one,
+            1, prec, MAG_BITS);
+
+    /* points sharing N have their power sums computed together
+       (split over threads by points); otherwise the sieved power
+       sum is threaded over k */
+    for (i = 0; i < num_em; i = j)
+    {
+        for (j = i + 1; j < num_em && N[j] == N[i]; j++) ;
+
+        wp = prec + 2 * (FLINT_BIT_COUNT(N[i]) + 1);
+        acb_dirichlet_series_multi_eval(sums + i, NULL, N[i], se + i,
+            j - i, wp);
+    }
+
+    for (i = 0; i < num_em; i++)
+    {
+        wp = prec + 2 * (FLINT_BIT_COUNT(N[i]) + 1);
+
+        _acb_poly_zeta_em_sum_remainder(u, se + i, one, 0, N[i], M[i], 1, wp);
+        acb_add(u, u, sums + i, wp);
+
+        _acb_poly_zeta_em_bound(vb, se + i, one, N[i], M[i], 1, MAG_BITS);
+        arb_get_mag(bound, vb);
+        arb_add_error_mag(acb_realref(u), bound);
+        if (!acb_is_real(se + i))
+            arb_add_error_mag(acb_imagref(u), bound);
+
+        acb_set_round(res + idx[i], u, prec);
+    }
+
+    _acb_vec_clear(se, num_em);
+    _acb_vec_clear(sums, num_em);
+    _arb_vec_clear(vb, 1);
+    acb_clear(one);
+    acb_clear(u);
+    mag_clear(bound);
+    flint_free(N);
+    flint_free(M);
+    flint_free(idx);
+}
+
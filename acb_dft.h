@@ -0,0 +1,102 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#ifndef ACB_DFT_H
+#define ACB_DFT_H
+
+#include "acb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ACB_DFT_NAIVE 0
+#define ACB_DFT_RAD2 1
+#define ACB_DFT_MIXED_RADIX 2
+#define ACB_DFT_BLUESTEIN 3
+
+/* use the naive algorithm up to this length */
+#define ACB_DFT_NAIVE_CUTOFF 16
+
+/* largest prime factor handled by the mixed-radix algorithm */
+#define ACB_DFT_MIXED_RADIX_MAX_PRIME 32
+
+typedef struct
+{
+    slong n;
+    int algorithm;
+    acb_ptr z;
+    slong zlen;
+    slong m;
+    acb_ptr b;
+    acb_ptr chat;
+}
+acb_dft_pre_struct;
+
+typedef acb_dft_pre_struct acb_dft_pre_t[1];
+
+void _acb_dft_roots(acb_ptr z, slong n, slong len, slong prec);
+
+void _acb_dft_naive(acb_ptr w, acb_srcptr v, slong vstride, slong n,
+    acb_srcptr z, slong zstride, slong prec);
+
+void _acb_dft_rad2(acb_ptr w, acb_srcptr v, slong vstride, slong n,
+    acb_srcptr z, slong zstride, slong prec, slong num_threads);
+
+void _acb_dft_mixed_radix(acb_ptr w, acb_srcptr v, slong vstride, slong n,
+    acb_srcptr z, slong zstride, slong prec);
+
+void _acb_dft_bluestein_init(acb_ptr b, acb_ptr chat, acb_ptr z,
+    slong n, slong m, slong prec);
+
+void _acb_dft_bluestein_precomp(acb_ptr w, acb_srcptr v, slong n,
+    acb_srcptr b, acb_srcptr chat, slong m, acb_srcptr z, slong prec);
+
+void acb_dft_naive(acb_ptr w, acb_srcptr v, slong n, slong prec);
+
+void acb_dft_rad2(acb_ptr w, acb_srcptr v, int e, slong prec);
+
+void acb_dft_mixed_radix(acb_ptr w, acb_srcptr v, slong n, slong prec);
+
+void acb_dft_bluestein(acb_ptr w, acb_srcptr v, slong n, slong prec);
+
+void acb_dft_pre_init(acb_dft_pre_t pre, slong n, slong prec);
+
+void acb_dft_pre_clear(acb_dft_pre_t pre);
+
+void acb_dft_precomp(acb_ptr w, acb_srcptr v, const acb_dft_pre_t pre, slong prec);
+
+void acb_dft_inverse_precomp(acb_ptr w, acb_srcptr v, const acb_dft_pre_t pre, slong prec);
+
+void acb_dft(acb_ptr w, acb_srcptr v, slong n, slong prec);
+
+void acb_dft_inverse(acb_ptr w, acb_srcptr v, slong n, slong prec);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
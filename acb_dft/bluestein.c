@@ -0,0 +1,142 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_dft.h"
+
+/* Bluestein's algorithm writes jk = (j^2 + k^2 - (k-j)^2) / 2, turning
+   the length-n transform into a cyclic convolution with the chirp
+   b_j = exp(pi i j^2 / n), which is done with radix-2 transforms of
+   length m >= 2n - 1. Sets b[j] for 0 <= j < n, the transform chat of
+   the zero-padded symmetric chirp, and the table z of m-th roots of
+   unity of length m/2. */
+void
+_acb_dft_bluestein_init(acb_ptr b, acb_ptr chat, acb_ptr z,
+    slong n, slong m, slong prec)
+{
+    acb_ptr c;
+    ulong j, jj, nn, ninv;
+    fmpq_t t;
+
+    _acb_dft_roots(z, m, m / 2, prec);
+
+    fmpq_init(t);
+    nn = 2 * (ulong) n;
+    ninv = n_preinvert_limb(nn);
+
+    for (j = 0; j < n; j++)
+    {
+        /* exp(pi i j^2 / n) only depends on j^2 mod 2n */
+        jj = n_mulmod2_preinv(j, j, nn, ninv);
+        fmpq_set_si(t, jj, n);
+        arb_sin_cos_pi_fmpq(acb_imagref(b + j), acb_realref(b + j), t, prec);
+    }
+
+    fmpq_clear(t);
+
+    c = _acb_vec_init(m);
+
+    for (j = 0; j < n; j++)
+    {
+        acb_set(c + j, b + j);
+        if (j != 0)
+            acb_set(c + m - j, b + j);
+    }
+
+    _acb_dft_rad2(chat, c, 1, m, z, 1, prec, flint_get_num_threads());
+
+    _acb_vec_clear(c, m);
+}
+
+void
+_acb_dft_bluestein_precomp(acb_ptr w, acb_srcptr v, slong n,
+    acb_srcptr b, acb_srcptr chat, slong m, acb_srcptr z, slong prec)
+{
+    acb_ptr a, ahat;
+    slong j, num_threads;
+    int e;
+
+    num_threads = flint_get_num_threads();
+    e = FLINT_BIT_COUNT(m) - 1;
+
+    a = _acb_vec_init(m);
+    ahat = _acb_vec_init(m);
+
+    for (j = 0; j < n; j++)
+    {
+        acb_conj(a + j, b + j);
+        acb_mul(a + j, a + j, v + j, prec);
+    }
+
+    _acb_dft_rad2(ahat, a, 1, m, z, 1, prec, num_threads);
+
+    /* inverse transform of ahat * chat as conj(dft(conj(.))) / m */
+    for (j = 0; j < m; j++)
+    {
+        acb_mul(a + j, ahat + j, chat + j, prec);
+        acb_conj(a + j, a + j);
+    }
+
+    _acb_dft_rad2(ahat, a, 1, m, z, 1, prec, num_threads);
+
+    for (j = 0; j < n; j++)
+    {
+        acb_mul(w + j, ahat + j, b + j, prec);
+        acb_conj(w + j, w + j);
+        acb_mul_2exp_si(w + j, w + j, -e);
+    }
+
+    _acb_vec_clear(a, m);
+    _acb_vec_clear(ahat, m);
+}
+
+void
+acb_dft_bluestein(acb_ptr w, acb_srcptr v, slong n, slong prec)
+{
+    acb_ptr b, chat, z;
+    slong m;
+
+    if (n <= 0)
+        return;
+
+    if (n == 1)
+    {
+        acb_set(w, v);
+        return;
+    }
+
+    m = WORD(1) << FLINT_BIT_COUNT(2 * n - 2);
+
+    b = _acb_vec_init(n);
+    chat = _acb_vec_init(m);
+    z = _acb_vec_init(m / 2);
+
+    _acb_dft_bluestein_init(b, chat, z, n, m, prec);
+    _acb_dft_bluestein_precomp(w, v, n, b, chat, m, z, prec);
+
+    _acb_vec_clear(b, n);
+    _acb_vec_clear(chat, m);
+    _acb_vec_clear(z, m / 2);
+}
+
@@ -0,0 +1,111 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_dft.h"
+
+void
+acb_dft_precomp(acb_ptr w, acb_srcptr v, const acb_dft_pre_t pre, slong prec)
+{
+    slong n = pre->n;
+    acb_ptr t;
+
+    if (n <= 0)
+        return;
+
+    if (pre->algorithm == ACB_DFT_BLUESTEIN)
+    {
+        _acb_dft_bluestein_precomp(w, v, n, pre->b, pre->chat,
+            pre->m, pre->z, prec);
+        return;
+    }
+
+    if (w == v)
+    {
+        t = _acb_vec_init(n);
+        _acb_vec_set(t, v, n);
+        acb_dft_precomp(w, t, pre, prec);
+        _acb_vec_clear(t, n);
+        return;
+    }
+
+    if (pre->algorithm == ACB_DFT_RAD2)
+        _acb_dft_rad2(w, v, 1, n, pre->z, 1, prec, flint_get_num_threads());
+    else if (pre->algorithm == ACB_DFT_MIXED_RADIX)
+        _acb_dft_mixed_radix(w, v, 1, n, pre->z, 1, prec);
+    else
+        _acb_dft_naive(w, v, 1, n, pre->z, 1, prec);
+}
+
+void
+acb_dft_inverse_precomp(acb_ptr w, acb_srcptr v, const acb_dft_pre_t pre, slong prec)
+{
+    slong i, n = pre->n;
+    acb_ptr t;
+
+    if (n <= 0)
+        return;
+
+    t = _acb_vec_init(n);
+
+    for (i = 0; i < n; i++)
+        acb_conj(t + i, v + i);
+
+    acb_dft_precomp(w, t, pre, prec);
+
+    for (i = 0; i < n; i++)
+    {
+        acb_conj(w + i, w + i);
+        acb_div_ui(w + i, w + i, n, prec);
+    }
+
+    _acb_vec_clear(t, n);
+}
+
+void
+acb_dft(acb_ptr w, acb_srcptr v, slong n, slong prec)
+{
+    acb_dft_pre_t pre;
+
+    if (n <= 0)
+        return;
+
+    acb_dft_pre_init(pre, n, prec);
+    acb_dft_precomp(w, v, pre, prec);
+    acb_dft_pre_clear(pre);
+}
+
+void
+acb_dft_inverse(acb_ptr w, acb_srcptr v, slong n, slong prec)
+{
+    acb_dft_pre_t pre;
+
+    if (n <= 0)
+        return;
+
+    acb_dft_pre_init(pre, n, prec);
+    acb_dft_inverse_precomp(w, v, pre, prec);
+    acb_dft_pre_clear(pre);
+}
+
@@ -0,0 +1,110 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_dft.h"
+
+/* Cooley-Tukey with the smallest prime factor p of n as the radix:
+   the p transforms of length n/p of the decimated inputs are combined
+   with twiddle factors taken from the table of n-th roots of unity
+   z[zstride * k] = exp(-2 pi i k / n), 0 <= k < n */
+void
+_acb_dft_mixed_radix(acb_ptr w, acb_srcptr v, slong vstride, slong n,
+    acb_srcptr z, slong zstride, slong prec)
+{
+    slong p, m, r, s, j, k, idx;
+    acb_ptr y;
+
+    if (n <= 2)
+    {
+        _acb_dft_naive(w, v, vstride, n, z, zstride, prec);
+        return;
+    }
+
+    for (p = 2; p * p <= n && n % p != 0; p++) ;
+
+    if (n % p != 0 || p == n)
+    {
+        _acb_dft_naive(w, v, vstride, n, z, zstride, prec);
+        return;
+    }
+
+    m = n / p;
+    y = _acb_vec_init(n);
+
+    for (r = 0; r < p; r++)
+        _acb_dft_mixed_radix(y + r * m, v + r * vstride, p * vstride, m,
+            z, p * zstride, prec);
+
+    for (j = 0; j < m; j++)
+    {
+        for (s = 0; s < p; s++)
+        {
+            k = j + m * s;
+            acb_set(w + k, y + j);
+            idx = 0;
+
+            for (r = 1; r < p; r++)
+            {
+                idx += k;
+                if (idx >= n)
+                    idx -= n;
+
+                if (idx == 0)
+                    acb_add(w + k, w + k, y + r * m + j, prec);
+                else
+                    acb_addmul(w + k, y + r * m + j, z + zstride * idx, prec);
+            }
+        }
+    }
+
+    _acb_vec_clear(y, n);
+}
+
+void
+acb_dft_mixed_radix(acb_ptr w, acb_srcptr v, slong n, slong prec)
+{
+    acb_ptr z, t;
+
+    if (n <= 0)
+        return;
+
+    z = _acb_vec_init(n);
+    _acb_dft_roots(z, n, n, prec);
+
+    if (w == v)
+    {
+        t = _acb_vec_init(n);
+        _acb_vec_set(t, v, n);
+        _acb_dft_mixed_radix(w, t, 1, n, z, 1, prec);
+        _acb_vec_clear(t, n);
+    }
+    else
+    {
+        _acb_dft_mixed_radix(w, v, 1, n, z, 1, prec);
+    }
+
+    _acb_vec_clear(z, n);
+}
+
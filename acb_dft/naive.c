@@ -0,0 +1,80 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_dft.h"
+
+/* w[k] = sum_j v[j * vstride] z[zstride * (jk mod n)], where
+   z[zstride] is a primitive n-th root of unity; w and v must not overlap */
+void
+_acb_dft_naive(acb_ptr w, acb_srcptr v, slong vstride, slong n,
+    acb_srcptr z, slong zstride, slong prec)
+{
+    slong j, k, idx;
+
+    for (k = 0; k < n; k++)
+    {
+        acb_set(w + k, v);
+        idx = 0;
+
+        for (j = 1; j < n; j++)
+        {
+            idx += k;
+            if (idx >= n)
+                idx -= n;
+
+            if (idx == 0)
+                acb_add(w + k, w + k, v + j * vstride, prec);
+            else
+                acb_addmul(w + k, v + j * vstride, z + zstride * idx, prec);
+        }
+    }
+}
+
+void
+acb_dft_naive(acb_ptr w, acb_srcptr v, slong n, slong prec)
+{
+    acb_ptr z, t;
+
+    if (n <= 0)
+        return;
+
+    z = _acb_vec_init(n);
+    _acb_dft_roots(z, n, n, prec);
+
+    if (w == v)
+    {
+        t = _acb_vec_init(n);
+        _acb_vec_set(t, v, n);
+        _acb_dft_naive(w, t, 1, n, z, 1, prec);
+        _acb_vec_clear(t, n);
+    }
+    else
+    {
+        _acb_dft_naive(w, v, 1, n, z, 1, prec);
+    }
+
+    _acb_vec_clear(z, n);
+}
+
@@ -0,0 +1,95 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_dft.h"
+
+static int
+_acb_dft_smooth(slong n)
+{
+    slong p;
+
+    for (p = 2; p <= ACB_DFT_MIXED_RADIX_MAX_PRIME; p++)
+        while (n % p == 0)
+            n /= p;
+
+    return n == 1;
+}
+
+void
+acb_dft_pre_init(acb_dft_pre_t pre, slong n, slong prec)
+{
+    pre->n = n;
+    pre->m = 0;
+    pre->b = NULL;
+    pre->chat = NULL;
+
+    if (n <= ACB_DFT_NAIVE_CUTOFF)
+    {
+        pre->algorithm = ACB_DFT_NAIVE;
+        pre->zlen = FLINT_MAX(n, 0);
+    }
+    else if ((n & (n - 1)) == 0)
+    {
+        pre->algorithm = ACB_DFT_RAD2;
+        pre->zlen = n / 2;
+    }
+    else if (_acb_dft_smooth(n))
+    {
+        pre->algorithm = ACB_DFT_MIXED_RADIX;
+        pre->zlen = n;
+    }
+    else
+    {
+        pre->algorithm = ACB_DFT_BLUESTEIN;
+        pre->m = WORD(1) << FLINT_BIT_COUNT(2 * n - 2);
+        pre->zlen = pre->m / 2;
+    }
+
+    pre->z = _acb_vec_init(pre->zlen);
+
+    if (pre->algorithm == ACB_DFT_BLUESTEIN)
+    {
+        pre->b = _acb_vec_init(n);
+        pre->chat = _acb_vec_init(pre->m);
+        _acb_dft_bluestein_init(pre->b, pre->chat, pre->z, n, pre->m, prec);
+    }
+    else
+    {
+        _acb_dft_roots(pre->z, n, pre->zlen, prec);
+    }
+}
+
+void
+acb_dft_pre_clear(acb_dft_pre_t pre)
+{
+    _acb_vec_clear(pre->z, pre->zlen);
+
+    if (pre->algorithm == ACB_DFT_BLUESTEIN)
+    {
+        _acb_vec_clear(pre->b, pre->n);
+        _acb_vec_clear(pre->chat, pre->m);
+    }
+}
+
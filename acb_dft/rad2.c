@@ -0,0 +1,155 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include <pthread.h>
+#include "acb_dft.h"
+
+/* fork the odd half onto a thread when n * prec exceeds this */
+#define THREADED_CUTOFF 100000
+
+typedef struct
+{
+    acb_ptr w;
+    acb_srcptr v;
+    slong vstride;
+    slong n;
+    acb_srcptr z;
+    slong zstride;
+    slong prec;
+    slong num_threads;
+}
+rad2_arg_t;
+
+static void *
+rad2_worker(void * arg_ptr)
+{
+    rad2_arg_t arg = *((rad2_arg_t *) arg_ptr);
+
+    _acb_dft_rad2(arg.w, arg.v, arg.vstride, arg.n, arg.z, arg.zstride,
+        arg.prec, arg.num_threads);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/* decimation in time: w[0,n/2) receives the transform of the even
+   entries and w[n/2,n) that of the odd entries, which are then combined
+   with butterflies; z[zstride * k] = exp(-2 pi i k / n) for k < n/2 */
+void
+_acb_dft_rad2(acb_ptr w, acb_srcptr v, slong vstride, slong n,
+    acb_srcptr z, slong zstride, slong prec, slong num_threads)
+{
+    slong k, half;
+    acb_t t;
+
+    if (n == 1)
+    {
+        acb_set(w, v);
+        return;
+    }
+
+    if (n == 2)
+    {
+        acb_add(w, v, v + vstride, prec);
+        acb_sub(w + 1, v, v + vstride, prec);
+        return;
+    }
+
+    half = n / 2;
+
+    if (num_threads > 1 && n * prec >= THREADED_CUTOFF)
+    {
+        pthread_t thread;
+        rad2_arg_t arg;
+
+        arg.w = w + half;
+        arg.v = v + vstride;
+        arg.vstride = 2 * vstride;
+        arg.n = half;
+        arg.z = z;
+        arg.zstride = 2 * zstride;
+        arg.prec = prec;
+        arg.num_threads = num_threads / 2;
+
+        pthread_create(&thread, NULL, rad2_worker, &arg);
+        _acb_dft_rad2(w, v, 2 * vstride, half, z, 2 * zstride, prec,
+            num_threads - num_threads / 2);
+        pthread_join(thread, NULL);
+    }
+    else
+    {
+        _acb_dft_rad2(w, v, 2 * vstride, half, z, 2 * zstride, prec, 1);
+        _acb_dft_rad2(w + half, v + vstride, 2 * vstride, half,
+            z, 2 * zstride, prec, 1);
+    }
+
+    acb_init(t);
+
+    for (k = 0; k < half; k++)
+    {
+        if (k == 0)
+            acb_set(t, w + half);
+        else
+            acb_mul(t, w + half + k, z + zstride * k, prec);
+
+        acb_sub(w + half + k, w + k, t, prec);
+        acb_add(w + k, w + k, t, prec);
+    }
+
+    acb_clear(t);
+}
+
+void
+acb_dft_rad2(acb_ptr w, acb_srcptr v, int e, slong prec)
+{
+    acb_ptr z, t;
+    slong n;
+
+    n = WORD(1) << e;
+
+    if (n == 1)
+    {
+        acb_set(w, v);
+        return;
+    }
+
+    z = _acb_vec_init(n / 2);
+    _acb_dft_roots(z, n, n / 2, prec);
+
+    if (w == v)
+    {
+        t = _acb_vec_init(n);
+        _acb_vec_set(t, v, n);
+        _acb_dft_rad2(w, t, 1, n, z, 1, prec, flint_get_num_threads());
+        _acb_vec_clear(t, n);
+    }
+    else
+    {
+        _acb_dft_rad2(w, v, 1, n, z, 1, prec, flint_get_num_threads());
+    }
+
+    _acb_vec_clear(z, n / 2);
+}
+
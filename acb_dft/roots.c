@@ -0,0 +1,74 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_dft.h"
+
+/* sets z[k] = exp(-2 pi i k / n) for 0 <= k < len, computing only the
+   first octant directly and filling in the rest by symmetry */
+void
+_acb_dft_roots(acb_ptr z, slong n, slong len, slong prec)
+{
+    slong k;
+    fmpq_t t;
+
+    if (len <= 0)
+        return;
+
+    fmpq_init(t);
+
+    for (k = 0; k < len; k++)
+    {
+        if (k == 0)
+        {
+            acb_one(z);
+        }
+        else if (2 * k > n)
+        {
+            /* exp(-2 pi i (n - k) / n) = conj(exp(-2 pi i k / n)) */
+            acb_conj(z + k, z + n - k);
+        }
+        else if (n % 2 == 0 && 4 * k > n)
+        {
+            /* angle pi - theta */
+            acb_conj(z + k, z + n / 2 - k);
+            acb_neg(z + k, z + k);
+        }
+        else if (n % 4 == 0 && 8 * k > n)
+        {
+            /* angle pi/2 - theta */
+            arb_neg(acb_realref(z + k), acb_imagref(z + n / 4 - k));
+            arb_neg(acb_imagref(z + k), acb_realref(z + n / 4 - k));
+        }
+        else
+        {
+            fmpq_set_si(t, 2 * k, n);
+            arb_sin_cos_pi_fmpq(acb_imagref(z + k), acb_realref(z + k), t, prec);
+            arb_neg(acb_imagref(z + k), acb_imagref(z + k));
+        }
+    }
+
+    fmpq_clear(t);
+}
+
@@ -0,0 +1,112 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_dft.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("dft....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000; iter++)
+    {
+        acb_ptr v, w1, w2;
+        slong i, n, prec;
+        int alg;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        if (n_randint(state, 4) == 0)
+            n = WORD(1) << n_randint(state, 9);
+        else
+            n = 1 + n_randint(state, 150);
+
+        prec = 2 + n_randint(state, 300);
+
+        v = _acb_vec_init(n);
+        w1 = _acb_vec_init(n);
+        w2 = _acb_vec_init(n);
+
+        for (i = 0; i < n; i++)
+            acb_randtest(v + i, state, 1 + n_randint(state, 300), 4);
+
+        acb_dft_naive(w1, v, n, prec);
+
+        alg = n_randint(state, 5);
+
+        if (alg == 0)
+        {
+            acb_dft(w2, v, n, prec);
+        }
+        else if (alg == 1)
+        {
+            _acb_vec_set(w2, v, n);
+            acb_dft(w2, w2, n, prec);
+        }
+        else if (alg == 2)
+        {
+            acb_dft_mixed_radix(w2, v, n, prec);
+        }
+        else if (alg == 3)
+        {
+            acb_dft_bluestein(w2, v, n, prec);
+        }
+        else
+        {
+            if ((n & (n - 1)) == 0)
+                acb_dft_rad2(w2, v, FLINT_BIT_COUNT(n) - 1, prec);
+            else
+                acb_dft(w2, v, n, prec);
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            if (!acb_overlaps(w1 + i, w2 + i))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("n = %wd, prec = %wd, alg = %d, i = %wd\n\n",
+                    n, prec, alg, i);
+                flint_printf("w1 = "); acb_printd(w1 + i, 30); flint_printf("\n\n");
+                flint_printf("w2 = "); acb_printd(w2 + i, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _acb_vec_clear(v, n);
+        _acb_vec_clear(w1, n);
+        _acb_vec_clear(w2, n);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,87 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_dft.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("dft_inverse....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000; iter++)
+    {
+        acb_ptr v, w;
+        slong i, n, prec;
+        acb_dft_pre_t pre;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        if (n_randint(state, 2))
+            n = 1 + n_randint(state, 1000);
+        else
+            n = 1 + n_randint(state, 60);
+
+        prec = 2 + n_randint(state, 200);
+
+        v = _acb_vec_init(n);
+        w = _acb_vec_init(n);
+
+        for (i = 0; i < n; i++)
+            acb_randtest(v + i, state, 1 + n_randint(state, 200), 4);
+
+        acb_dft_pre_init(pre, n, prec);
+
+        acb_dft_precomp(w, v, pre, prec);
+        acb_dft_inverse_precomp(w, w, pre, prec);
+
+        for (i = 0; i < n; i++)
+        {
+            if (!acb_contains(w + i, v + i))
+            {
+                flint_printf("FAIL: containment\n\n");
+                flint_printf("n = %wd, prec = %wd, algorithm = %d, i = %wd\n\n",
+                    n, prec, pre->algorithm, i);
+                flint_printf("v = "); acb_printd(v + i, 30); flint_printf("\n\n");
+                flint_printf("w = "); acb_printd(w + i, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        acb_dft_pre_clear(pre);
+        _acb_vec_clear(v, n);
+        _acb_vec_clear(w, n);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,76 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#ifndef ACB_DIRICHLET_H
+#define ACB_DIRICHLET_H
+
+#include "acb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* the multiplicative group (Z/qZ)^*, as a product of cyclic groups of
+   orders phi[i] generated by gen[i]; P[i] is the prime and PE[i] the
+   prime power modulus of the i-th component */
+typedef struct
+{
+    ulong q;
+    ulong phi_q;
+    ulong expo;
+    slong num;
+    ulong * P;
+    ulong * PE;
+    ulong * phi;
+    ulong * gen;
+}
+acb_dirichlet_group_struct;
+
+typedef acb_dirichlet_group_struct acb_dirichlet_group_t[1];
+
+void acb_dirichlet_group_init(acb_dirichlet_group_t G, ulong q);
+
+void acb_dirichlet_group_clear(acb_dirichlet_group_t G);
+
+void acb_dirichlet_group_log(ulong * x, const acb_dirichlet_group_t G, ulong n);
+
+void acb_dirichlet_chi(acb_t res, const acb_dirichlet_group_t G,
+    ulong j, ulong n, slong prec);
+
+void acb_dirichlet_l(acb_t res, const acb_t s,
+    const acb_dirichlet_group_t G, ulong j, slong prec);
+
+void acb_dirichlet_l_vec(acb_ptr res, const acb_t s,
+    const acb_dirichlet_group_t G, slong prec);
+
+void acb_dirichlet_series_multi_eval(acb_ptr res, acb_srcptr a, slong n,
+    acb_srcptr s, slong num, slong prec);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
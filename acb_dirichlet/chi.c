@@ -0,0 +1,67 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_dirichlet.h"
+
+void
+acb_dirichlet_chi(acb_t res, const acb_dirichlet_group_t G,
+    ulong j, ulong n, slong prec)
+{
+    ulong * x;
+    ulong k, b, einv;
+    slong i;
+    fmpq_t t;
+
+    if (n_gcd(n % G->q, G->q) != 1)
+    {
+        acb_zero(res);
+        return;
+    }
+
+    x = flint_malloc(sizeof(ulong) * FLINT_MAX(G->num, 1));
+    acb_dirichlet_group_log(x, G, n);
+
+    /* chi_j(n) = exp(2 pi i k / expo) */
+    k = 0;
+    einv = n_preinvert_limb(G->expo);
+    for (i = G->num - 1; i >= 0; i--)
+    {
+        b = j % G->phi[i];
+        j = j / G->phi[i];
+        b = n_mulmod2_preinv(b, x[i], G->expo, einv);
+        b = n_mulmod2_preinv(b, G->expo / G->phi[i], G->expo, einv);
+        k = n_addmod(k, b, G->expo);
+    }
+
+    fmpq_init(t);
+    fmpz_set_ui(fmpq_numref(t), 2 * k);
+    fmpz_set_ui(fmpq_denref(t), G->expo);
+    fmpq_canonicalise(t);
+    arb_sin_cos_pi_fmpq(acb_imagref(res), acb_realref(res), t, prec);
+    fmpq_clear(t);
+
+    flint_free(x);
+}
+
@@ -0,0 +1,149 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_dirichlet.h"
+
+/* crt lift of g mod pe to the residue mod q which is 1 mod q / pe */
+static ulong
+lift_gen(ulong g, ulong pe, ulong q)
+{
+    ulong m, t;
+
+    m = q / pe;
+
+    if (m == 1)
+        return g;
+
+    t = n_invmod(m % pe, pe);
+    t = n_mulmod2_preinv((g + pe - 1) % pe, t, pe, n_preinvert_limb(pe));
+
+    return 1 + m * t;
+}
+
+void
+acb_dirichlet_group_init(acb_dirichlet_group_t G, ulong q)
+{
+    n_factor_t fac;
+    slong i, j, k;
+    ulong p, pe, g, t;
+
+    if (q == 0)
+    {
+        flint_printf("acb_dirichlet_group_init: q must be positive\n");
+        abort();
+    }
+
+    n_factor_init(&fac);
+    if (q > 1)
+        n_factor(&fac, q, 1);
+
+    /* sort the prime factors so that the components come in a fixed order */
+    for (i = 1; i < fac.num; i++)
+    {
+        for (j = i; j > 0 && fac.p[j - 1] > fac.p[j]; j--)
+        {
+            t = fac.p[j]; fac.p[j] = fac.p[j - 1]; fac.p[j - 1] = t;
+            t = fac.exp[j]; fac.exp[j] = fac.exp[j - 1]; fac.exp[j - 1] = t;
+        }
+    }
+
+    G->num = 0;
+    for (i = 0; i < fac.num; i++)
+    {
+        if (fac.p[i] != 2)
+            G->num += 1;
+        else if (fac.exp[i] == 2)
+            G->num += 1;
+        else if (fac.exp[i] >= 3)
+            G->num += 2;
+    }
+
+    G->q = q;
+    G->P = flint_malloc(sizeof(ulong) * FLINT_MAX(G->num, 1));
+    G->PE = flint_malloc(sizeof(ulong) * FLINT_MAX(G->num, 1));
+    G->phi = flint_malloc(sizeof(ulong) * FLINT_MAX(G->num, 1));
+    G->gen = flint_malloc(sizeof(ulong) * FLINT_MAX(G->num, 1));
+
+    k = 0;
+    for (i = 0; i < fac.num; i++)
+    {
+        p = fac.p[i];
+        pe = n_pow(p, fac.exp[i]);
+
+        if (p == 2)
+        {
+            if (fac.exp[i] == 1)
+                continue;
+
+            /* -1 generates a subgroup of order 2 */
+            G->P[k] = 2;
+            G->PE[k] = pe;
+            G->phi[k] = 2;
+            G->gen[k] = lift_gen(pe - 1, pe, q);
+            k++;
+
+            /* and 5 generates a complement of order 2^(e-2) */
+            if (fac.exp[i] >= 3)
+            {
+                G->P[k] = 2;
+                G->PE[k] = pe;
+                G->phi[k] = pe / 4;
+                G->gen[k] = lift_gen(5, pe, q);
+                k++;
+            }
+        }
+        else
+        {
+            /* a primitive root mod p^2 is one mod every power of p */
+            g = n_primitive_root_prime(p);
+            if (fac.exp[i] > 1 && n_powmod2(g, p - 1, p * p) == 1)
+                g += p;
+
+            G->P[k] = p;
+            G->PE[k] = pe;
+            G->phi[k] = (pe / p) * (p - 1);
+            G->gen[k] = lift_gen(g % pe, pe, q);
+            k++;
+        }
+    }
+
+    G->phi_q = 1;
+    G->expo = 1;
+    for (k = 0; k < G->num; k++)
+    {
+        G->phi_q *= G->phi[k];
+        G->expo = (G->expo / n_gcd(G->expo, G->phi[k])) * G->phi[k];
+    }
+}
+
+void
+acb_dirichlet_group_clear(acb_dirichlet_group_t G)
+{
+    flint_free(G->P);
+    flint_free(G->PE);
+    flint_free(G->phi);
+    flint_free(G->gen);
+}
+
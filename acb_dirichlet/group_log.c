@@ -0,0 +1,68 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_dirichlet.h"
+
+void
+acb_dirichlet_group_log(ulong * x, const acb_dirichlet_group_t G, ulong n)
+{
+    slong k;
+    ulong pe, g, m, h, e, pinv;
+
+    for (k = 0; k < G->num; k++)
+    {
+        pe = G->PE[k];
+        g = G->gen[k] % pe;
+        m = n % pe;
+
+        if (G->P[k] == 2 && pe >= 8)
+        {
+            if (g == pe - 1)
+            {
+                x[k] = (m % 4 == 3);
+                continue;
+            }
+
+            /* the component generated by 5 sees n up to sign */
+            if (m % 4 == 3)
+                m = pe - m;
+        }
+
+        /* exhaustive search */
+        pinv = n_preinvert_limb(pe);
+        h = 1 % pe;
+        for (e = 0; e < G->phi[k] && h != m; e++)
+            h = n_mulmod2_preinv(h, g, pe, pinv);
+
+        if (h != m)
+        {
+            flint_printf("acb_dirichlet_group_log: n must be coprime to q\n");
+            abort();
+        }
+
+        x[k] = e;
+    }
+}
+
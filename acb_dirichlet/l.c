@@ -0,0 +1,98 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_dirichlet.h"
+#include "acb_dft.h"
+
+void
+acb_dirichlet_l(acb_t res, const acb_t s,
+    const acb_dirichlet_group_t G, ulong j, slong prec)
+{
+    ulong * x;
+    ulong * c;
+    ulong a, k, idx, qinv;
+    slong i, wp;
+    acb_ptr z;
+    acb_t t, u, sum;
+
+    x = flint_calloc(FLINT_MAX(G->num, 1), sizeof(ulong));
+    c = flint_malloc(sizeof(ulong) * FLINT_MAX(G->num, 1));
+
+    /* moving along the i-th component multiplies chi by
+       exp(2 pi i c[i] / expo) */
+    for (i = G->num - 1; i >= 0; i--)
+    {
+        c[i] = (j % G->phi[i]) * (G->expo / G->phi[i]);
+        j = j / G->phi[i];
+    }
+
+    wp = prec + FLINT_BIT_COUNT(G->phi_q) + 6;
+
+    z = _acb_vec_init(G->expo);
+    _acb_dft_roots(z, G->expo, G->expo, wp);
+
+    acb_init(t);
+    acb_init(u);
+    acb_init(sum);
+
+    qinv = n_preinvert_limb(G->q);
+
+    /* L(s, chi) = q^(-s) sum_{a mod q} chi(a) zeta(s, a/q), with a
+       running through the products of powers of the generators */
+    a = 1;
+    k = 0;
+    for (idx = 0; idx < G->phi_q; idx++)
+    {
+        acb_set_ui(t, a);
+        acb_div_ui(t, t, G->q, wp);
+        acb_hurwitz_zeta(u, s, t, wp);
+        acb_addmul(sum, z + (G->expo - k) % G->expo, u, wp);
+
+        for (i = G->num - 1; i >= 0; i--)
+        {
+            a = n_mulmod2_preinv(a, G->gen[i], G->q, qinv);
+            k = n_addmod(k, c[i], G->expo);
+            x[i]++;
+
+            if (x[i] < G->phi[i])
+                break;
+
+            x[i] = 0;
+        }
+    }
+
+    acb_set_ui(t, G->q);
+    acb_neg(u, s);
+    acb_pow(t, t, u, wp);
+    acb_mul(res, sum, t, prec);
+
+    _acb_vec_clear(z, G->expo);
+    acb_clear(t);
+    acb_clear(u);
+    acb_clear(sum);
+    flint_free(x);
+    flint_free(c);
+}
+
@@ -0,0 +1,119 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_dirichlet.h"
+#include "acb_dft.h"
+
+void
+acb_dirichlet_l_vec(acb_ptr res, const acb_t s,
+    const acb_dirichlet_group_t G, slong prec)
+{
+    ulong * x;
+    ulong a, idx, qinv, n, st, base, r, m;
+    slong i, wp;
+    acb_ptr h, v, w;
+    acb_dft_pre_t pre;
+    acb_t t, u;
+
+    x = flint_calloc(FLINT_MAX(G->num, 1), sizeof(ulong));
+
+    wp = prec + FLINT_BIT_COUNT(G->phi_q) + 6;
+
+    acb_init(t);
+    acb_init(u);
+
+    h = _acb_vec_init(G->q);
+    acb_hurwitz_zeta_vec_rational(h, s, G->q, wp);
+
+    /* res[x] = zeta(s, a/q) where a = prod gen[i]^x[i], with x stored
+       in mixed radix (the last component varying fastest); this is
+       the same layout as the character index */
+    qinv = n_preinvert_limb(G->q);
+    a = 1;
+    for (idx = 0; idx < G->phi_q; idx++)
+    {
+        acb_swap(res + idx, h + a - 1);
+
+        for (i = G->num - 1; i >= 0; i--)
+        {
+            a = n_mulmod2_preinv(a, G->gen[i], G->q, qinv);
+            x[i]++;
+
+            if (x[i] < G->phi[i])
+                break;
+
+            x[i] = 0;
+        }
+    }
+
+    _acb_vec_clear(h, G->q);
+
+    /* the character sums form a multidimensional DFT over the product
+       of the cyclic components; transform along one axis at a time,
+       reversing the output since chi(gen) = exp(+2 pi i / phi) */
+    st = 1;
+    for (i = G->num - 1; i >= 0; i--)
+    {
+        n = G->phi[i];
+
+        if (n > 1)
+        {
+            v = _acb_vec_init(n);
+            w = _acb_vec_init(n);
+            acb_dft_pre_init(pre, n, wp);
+
+            for (base = 0; base < G->phi_q; base += n * st)
+            {
+                for (r = 0; r < st; r++)
+                {
+                    for (m = 0; m < n; m++)
+                        acb_swap(v + m, res + base + r + m * st);
+
+                    acb_dft_precomp(w, v, pre, wp);
+
+                    for (m = 0; m < n; m++)
+                        acb_swap(res + base + r + m * st, w + (n - m) % n);
+                }
+            }
+
+            acb_dft_pre_clear(pre);
+            _acb_vec_clear(v, n);
+            _acb_vec_clear(w, n);
+        }
+
+        st *= n;
+    }
+
+    acb_set_ui(t, G->q);
+    acb_neg(u, s);
+    acb_pow(t, t, u, wp);
+    for (idx = 0; idx < G->phi_q; idx++)
+        acb_mul(res + idx, res + idx, t, prec);
+
+    acb_clear(t);
+    acb_clear(u);
+    flint_free(x);
+}
+
@@ -0,0 +1,201 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include <pthread.h>
+#include "acb_poly.h"
+#include "acb_dirichlet.h"
+
+typedef struct
+{
+    acb_ptr res;
+    acb_srcptr a;
+    arb_srcptr logs;
+    acb_srcptr s;
+    slong num;
+    slong k0;
+    slong k1;
+    slong prec;
+}
+multi_eval_arg_t;
+
+/* res[j] = sum_{k0 <= k < k1} a_k k^(-s_j) for 0 <= j < num; if a is NULL,
+   the whole sum over 1 <= k < k1 is computed with the sieved power sum,
+   which needs one exponential per prime and one multiplication per
+   composite */
+static void
+multi_eval(multi_eval_arg_t arg)
+{
+    slong j, k;
+    acb_t t;
+
+    if (arg.a == NULL)
+    {
+        for (j = 0; j < arg.num; j++)
+            _acb_poly_powsum_one_series_sieved(arg.res + j, arg.s + j,
+                arg.k1 - 1, 1, arg.prec);
+        return;
+    }
+
+    acb_init(t);
+
+    for (j = 0; j < arg.num; j++)
+    {
+        acb_zero(arg.res + j);
+
+        for (k = arg.k0; k < arg.k1; k++)
+        {
+            if (k == 1)
+            {
+                acb_one(t);
+            }
+            else
+            {
+                acb_mul_arb(t, arg.s + j, arg.logs + k, arg.prec);
+                acb_neg(t, t);
+                acb_exp(t, t, arg.prec);
+            }
+
+            acb_addmul(arg.res + j, t, arg.a + k - 1, arg.prec);
+        }
+    }
+
+    acb_clear(t);
+}
+
+static void *
+multi_eval_worker(void * arg_ptr)
+{
+    multi_eval(*((multi_eval_arg_t *) arg_ptr));
+    flint_cleanup();
+    return NULL;
+}
+
+void
+acb_dirichlet_series_multi_eval(acb_ptr res, acb_srcptr a, slong n,
+    acb_srcptr s, slong num, slong prec)
+{
+    pthread_t * threads;
+    multi_eval_arg_t * args;
+    arb_ptr logs;
+    slong i, j, num_threads;
+    int split_points;
+
+    if (num <= 0)
+        return;
+
+    if (n <= 0)
+    {
+        _acb_vec_zero(res, num);
+        return;
+    }
+
+    num_threads = flint_get_num_threads();
+
+    if (a == NULL)
+    {
+        /* with few points, thread each power sum over k instead */
+        if (num < num_threads)
+        {
+            for (j = 0; j < num; j++)
+                _acb_poly_powsum_one_series_sieved_threaded(res + j, s + j,
+                    n, 1, prec);
+            return;
+        }
+
+        logs = NULL;
+    }
+    else
+    {
+        /* the logarithms are shared by all points */
+        logs = _arb_vec_init(n + 1);
+        arb_log_ui_vec(logs, n + 1, prec);
+
+        num_threads = FLINT_MIN(num_threads, FLINT_MAX(num, n / 16));
+        num_threads = FLINT_MAX(num_threads, 1);
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(multi_eval_arg_t) * num_threads);
+
+    /* split the points if there are enough of them, otherwise
+       split the range of k and add up the partial sums */
+    split_points = (num >= num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].a = a;
+        args[i].logs = logs;
+        args[i].prec = prec;
+
+        if (split_points)
+        {
+            args[i].res = res + (num * i) / num_threads;
+            args[i].s = s + (num * i) / num_threads;
+            args[i].num = (num * (i + 1)) / num_threads - (num * i) / num_threads;
+            args[i].k0 = 1;
+            args[i].k1 = n + 1;
+        }
+        else
+        {
+            args[i].res = _acb_vec_init(num);
+            args[i].s = s;
+            args[i].num = num;
+            args[i].k0 = 1 + (n * i) / num_threads;
+            args[i].k1 = 1 + (n * (i + 1)) / num_threads;
+        }
+    }
+
+    if (num_threads == 1)
+    {
+        multi_eval(args[0]);
+    }
+    else
+    {
+        for (i = 0; i < num_threads; i++)
+            pthread_create(&threads[i], NULL, multi_eval_worker, &args[i]);
+
+        for (i = 0; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+    }
+
+    if (!split_points)
+    {
+        _acb_vec_zero(res, num);
+
+        for (i = 0; i < num_threads; i++)
+        {
+            for (j = 0; j < num; j++)
+                acb_add(res + j, res + j, args[i].res + j, prec);
+
+            _acb_vec_clear(args[i].res, num);
+        }
+    }
+
+    if (logs != NULL)
+        _arb_vec_clear(logs, n + 1);
+    flint_free(threads);
+    flint_free(args);
+}
+
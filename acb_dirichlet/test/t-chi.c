@@ -0,0 +1,106 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_dirichlet.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("chi....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 3000; iter++)
+    {
+        acb_dirichlet_group_t G;
+        acb_t a, b, c, sum;
+        ulong q, j, m, n;
+        slong prec;
+
+        q = 1 + n_randint(state, n_randint(state, 2) ? 30 : 1000);
+        prec = 2 + n_randint(state, 200);
+
+        acb_dirichlet_group_init(G, q);
+        acb_init(a);
+        acb_init(b);
+        acb_init(c);
+        acb_init(sum);
+
+        j = n_randint(state, G->phi_q);
+        m = n_randtest(state);
+        n = n_randtest(state);
+
+        /* chi(mn) = chi(m) chi(n) */
+        acb_dirichlet_chi(a, G, j, m, prec);
+        acb_dirichlet_chi(b, G, j, n, prec);
+        acb_mul(a, a, b, prec);
+        acb_dirichlet_chi(c, G, j, n_mulmod2(m % q, n % q, q), prec);
+
+        if (!acb_overlaps(a, c))
+        {
+            flint_printf("FAIL: multiplicativity\n\n");
+            flint_printf("q = %wu, j = %wu, m = %wu, n = %wu\n\n", q, j, m, n);
+            flint_printf("a = "); acb_printd(a, 15); flint_printf("\n\n");
+            flint_printf("c = "); acb_printd(c, 15); flint_printf("\n\n");
+            abort();
+        }
+
+        /* orthogonality */
+        if (q <= 30)
+        {
+            for (n = 0; n < q; n++)
+            {
+                acb_dirichlet_chi(a, G, j, n, prec);
+                acb_add(sum, sum, a, prec);
+            }
+
+            if (j == 0)
+                acb_sub_ui(sum, sum, G->phi_q, prec);
+
+            if (!acb_contains_zero(sum))
+            {
+                flint_printf("FAIL: orthogonality\n\n");
+                flint_printf("q = %wu, j = %wu\n\n", q, j);
+                flint_printf("sum = "); acb_printd(sum, 15); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        acb_dirichlet_group_clear(G);
+        acb_clear(a);
+        acb_clear(b);
+        acb_clear(c);
+        acb_clear(sum);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
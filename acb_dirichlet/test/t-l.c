@@ -0,0 +1,126 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_dirichlet.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("l....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* L(2, chi_{-4}) is Catalan's constant */
+    {
+        acb_dirichlet_group_t G;
+        acb_t s, z;
+        arb_t c;
+
+        acb_dirichlet_group_init(G, 4);
+        acb_init(s);
+        acb_init(z);
+        arb_init(c);
+
+        acb_set_ui(s, 2);
+        acb_dirichlet_l(z, s, G, 1, 100);
+        arb_const_catalan(c, 100);
+
+        if (!arb_overlaps(acb_realref(z), c) ||
+            !arb_contains_zero(acb_imagref(z)) || acb_rel_accuracy_bits(z) < 90)
+        {
+            flint_printf("FAIL: catalan\n\n");
+            flint_printf("z = "); acb_printd(z, 30); flint_printf("\n\n");
+            abort();
+        }
+
+        acb_dirichlet_group_clear(G);
+        acb_clear(s);
+        acb_clear(z);
+        arb_clear(c);
+    }
+
+    for (iter = 0; iter < 200; iter++)
+    {
+        acb_dirichlet_group_t G;
+        acb_t s, z1, z2, t;
+        ulong p, q;
+        slong prec;
+
+        q = 1 + n_randint(state, 50);
+        prec = 2 + n_randint(state, 100);
+
+        acb_dirichlet_group_init(G, q);
+        acb_init(s);
+        acb_init(z1);
+        acb_init(z2);
+        acb_init(t);
+
+        acb_randtest(s, state, 1 + n_randint(state, 100), 2);
+        arb_add_ui(acb_realref(s), acb_realref(s), 2, prec);
+
+        /* the principal character gives zeta with the euler factors
+           at p | q removed */
+        acb_dirichlet_l(z1, s, G, 0, prec);
+
+        acb_zeta(z2, s, prec);
+        for (p = 2; p <= q; p++)
+        {
+            if (q % p == 0 && n_is_prime(p))
+            {
+                acb_set_ui(t, p);
+                acb_pow(t, t, s, prec);
+                acb_inv(t, t, prec);
+                acb_sub_ui(t, t, 1, prec);
+                acb_neg(t, t);
+                acb_mul(z2, z2, t, prec);
+            }
+        }
+
+        if (!acb_overlaps(z1, z2))
+        {
+            flint_printf("FAIL: overlap\n\n");
+            flint_printf("q = %wu\n\n", q);
+            flint_printf("s = "); acb_printd(s, 15); flint_printf("\n\n");
+            flint_printf("z1 = "); acb_printd(z1, 15); flint_printf("\n\n");
+            flint_printf("z2 = "); acb_printd(z2, 15); flint_printf("\n\n");
+            abort();
+        }
+
+        acb_dirichlet_group_clear(G);
+        acb_clear(s);
+        acb_clear(z1);
+        acb_clear(z2);
+        acb_clear(t);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,86 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_dirichlet.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("l_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 200; iter++)
+    {
+        acb_dirichlet_group_t G;
+        acb_ptr v;
+        acb_t s, z;
+        ulong q, j;
+        slong prec;
+
+        q = 1 + n_randint(state, 100);
+        prec = 2 + n_randint(state, 100);
+
+        acb_dirichlet_group_init(G, q);
+        v = _acb_vec_init(G->phi_q);
+        acb_init(s);
+        acb_init(z);
+
+        acb_randtest(s, state, 1 + n_randint(state, 100), 2);
+        if (n_randint(state, 2))
+            arb_set_d(acb_realref(s), 0.5);
+
+        acb_dirichlet_l_vec(v, s, G, prec);
+
+        for (j = 0; j < G->phi_q; j++)
+        {
+            acb_dirichlet_l(z, s, G, j, prec);
+
+            if (!acb_overlaps(z, v + j))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("q = %wu, j = %wu\n\n", q, j);
+                flint_printf("s = "); acb_printd(s, 15); flint_printf("\n\n");
+                flint_printf("z = "); acb_printd(z, 15); flint_printf("\n\n");
+                flint_printf("v = "); acb_printd(v + j, 15); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _acb_vec_clear(v, G->phi_q);
+        acb_dirichlet_group_clear(G);
+        acb_clear(s);
+        acb_clear(z);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,115 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_dirichlet.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("series_multi_eval....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000; iter++)
+    {
+        acb_ptr a, s, r1, r2;
+        acb_t t, u;
+        slong j, k, n, num, prec;
+        int ones;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        prec = 2 + n_randint(state, 200);
+        n = n_randint(state, n_randint(state, 2) ? 30 : 300);
+        num = n_randint(state, 10);
+        ones = n_randint(state, 2);
+
+        a = _acb_vec_init(n);
+        s = _acb_vec_init(num);
+        r1 = _acb_vec_init(num);
+        r2 = _acb_vec_init(num);
+        acb_init(t);
+        acb_init(u);
+
+        for (k = 0; k < n; k++)
+        {
+            if (ones)
+                acb_one(a + k);
+            else
+                acb_randtest(a + k, state, 1 + n_randint(state, 200), 3);
+        }
+
+        for (j = 0; j < num; j++)
+        {
+            if (n_randint(state, 4) == 0)
+                acb_set_si(s + j, n_randint(state, 10) - 3);
+            else
+                acb_randtest(s + j, state, 1 + n_randint(state, 200), 3);
+        }
+
+        acb_dirichlet_series_multi_eval(r1, ones ? NULL : a, n, s, num, prec);
+
+        for (j = 0; j < num; j++)
+        {
+            acb_zero(r2 + j);
+
+            for (k = 1; k <= n; k++)
+            {
+                acb_neg(t, s + j);
+                acb_set_ui(u, k);
+                acb_pow(t, u, t, prec);
+                acb_addmul(r2 + j, a + k - 1, t, prec);
+            }
+
+            if (!acb_overlaps(r1 + j, r2 + j))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("iter = %wd\n", iter);
+                flint_printf("n = %wd, num = %wd, j = %wd, prec = %wd\n\n", n, num, j, prec);
+                flint_printf("s = "); acb_printd(s + j, 15); flint_printf("\n\n");
+                flint_printf("r1 = "); acb_printd(r1 + j, 15); flint_printf("\n\n");
+                flint_printf("r2 = "); acb_printd(r2 + j, 15); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _acb_vec_clear(a, n);
+        _acb_vec_clear(s, num);
+        _acb_vec_clear(r1, num);
+        _acb_vec_clear(r2, num);
+        acb_clear(t);
+        acb_clear(u);
+    }
+
+    flint_set_num_threads(1);
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
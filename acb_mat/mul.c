@@ -28,49 +28,16 @@
 void
 acb_mat_mul(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong prec)
 {
-    slong ar, ac, br, bc, i, j, k;
-
-    ar = acb_mat_nrows(A);
-    ac = acb_mat_ncols(A);
-    br = acb_mat_nrows(B);
-    bc = acb_mat_ncols(B);
-
-    if (ac != br || ar != acb_mat_nrows(C) || bc != acb_mat_ncols(C))
-    {
-        flint_printf("acb_mat_mul: incompatible dimensions\n");
-        abort();
-    }
-
-    if (br == 0)
+    if (flint_get_num_threads() > 1 &&
+        ((double) acb_mat_nrows(A) *
+         (double) acb_mat_nrows(B) *
+         (double) acb_mat_ncols(B) *
+         (double) prec > 100000))
     {
-        acb_mat_zero(C);
-        return;
+        acb_mat_mul_threaded(C, A, B, prec);
     }
-
-    if (A == C || B == C)
+    else
     {
-        acb_mat_t T;
-        acb_mat_init(T, ar, bc);
-        acb_mat_mul(T, A, B, prec);
-        acb_mat_swap(T, C);
-        acb_mat_clear(T);
-        return;
-    }
-
-    for (i = 0; i < ar; i++)
-    {
-        for (j = 0; j < bc; j++)
-        {
-            acb_mul(acb_mat_entry(C, i, j),
-                      acb_mat_entry(A, i, 0),
-                      acb_mat_entry(B, 0, j), prec);
-
-            for (k = 1; k < br; k++)
-            {
-                acb_addmul(acb_mat_entry(C, i, j),
-                             acb_mat_entry(A, i, k),
-                             acb_mat_entry(B, k, j), prec);
-            }
-        }
+        acb_mat_mul_classical(C, A, B, prec);
     }
 }
@@ -336,6 +336,26 @@ void _acb_poly_compose_divconquer(acb_ptr res,
 void acb_poly_compose_divconquer(acb_poly_t res,
               const acb_poly_t poly1, const acb_poly_t poly2, slong prec);
 
+void _acb_poly_taylor_shift_horner(acb_ptr poly, const acb_t c, slong n, slong prec);
+
+void acb_poly_taylor_shift_horner(acb_poly_t g, const acb_poly_t f,
+    const acb_t c, slong prec);
+
+void _acb_poly_taylor_shift_divconquer(acb_ptr poly, const acb_t c, slong n, slong prec);
+
+void acb_poly_taylor_shift_divconquer(acb_poly_t g, const acb_poly_t f,
+    const acb_t c, slong prec);
+
+void _acb_poly_taylor_shift_convolution(acb_ptr poly, const acb_t c, slong n, slong prec);
+
+void acb_poly_taylor_shift_convolution(acb_poly_t g, const acb_poly_t f,
+    const acb_t c, slong prec);
+
+void _acb_poly_taylor_shift(acb_ptr poly, const acb_t c, slong n, slong prec);
+
+void acb_poly_taylor_shift(acb_poly_t g, const acb_poly_t f,
+    const acb_t c, slong prec);
+
 void _acb_poly_compose_series_horner(acb_ptr res, acb_srcptr poly1, slong len1,
                             acb_srcptr poly2, slong len2, slong n, slong prec);
 
@@ -446,9 +466,18 @@ void _acb_poly_root_inclusion(acb_t r, const acb_t m,
 slong _acb_poly_validate_roots(acb_ptr roots,
         acb_srcptr poly, slong len, slong prec);
 
+void _acb_poly_evaluate_mid(acb_t res, acb_srcptr f, slong len,
+    const acb_t a, slong prec);
+
 void _acb_poly_refine_roots_durand_kerner(acb_ptr roots,
         acb_srcptr poly, slong len, slong prec);
 
+void _acb_poly_refine_roots_aberth(acb_ptr roots, acb_srcptr poly,
+        acb_srcptr deriv, slong len, slong prec);
+
+slong _acb_poly_find_roots_d(acb_ptr roots, acb_srcptr poly, slong len,
+    slong maxiter);
+
 slong _acb_poly_find_roots(acb_ptr roots,
     acb_srcptr poly,
     acb_srcptr initial, slong len, slong maxiter, slong prec);
@@ -626,7 +655,9 @@ void _acb_poly_mullow_cpx(acb_ptr res, acb_srcptr src, slong len, const acb_t c,
 void _acb_poly_powsum_series_naive(acb_ptr z, const acb_t s, const acb_t a, const acb_t q, slong n, slong len, slong prec);
 void _acb_poly_powsum_series_naive_threaded(acb_ptr z, const acb_t s, const acb_t a, const acb_t q, slong n, slong len, slong prec);
 void _acb_poly_powsum_one_series_sieved(acb_ptr z, const acb_t s, slong n, slong len, slong prec);
+void _acb_poly_powsum_one_series_sieved_threaded(acb_ptr z, const acb_t s, slong n, slong len, slong prec);
 
+void _acb_poly_zeta_em_sum_remainder(acb_ptr z, const acb_t s, const acb_t a, int deflate, ulong N, ulong M, slong d, slong prec);
 void _acb_poly_zeta_em_sum(acb_ptr z, const acb_t s, const acb_t a, int deflate, ulong N, ulong M, slong d, slong prec);
 void _acb_poly_zeta_em_choose_param(mag_t bound, ulong * N, ulong * M, const acb_t s, const acb_t a, slong d, slong target, slong prec);
 void _acb_poly_zeta_em_bound1(mag_t bound, const acb_t s, const acb_t a, slong N, slong M, slong d, slong wp);
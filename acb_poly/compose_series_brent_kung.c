@@ -23,9 +23,149 @@
 
 ******************************************************************************/
 
+#include <pthread.h>
 #include "acb_poly.h"
 #include "acb_mat.h"
 
+/* use threads for n at least this large */
+#define THREADED_CUTOFF 100
+
+/* res = x * y mod x^n (+ c, if c is not NULL) */
+typedef struct
+{
+    acb_ptr res;
+    acb_srcptr x;
+    acb_srcptr y;
+    acb_srcptr c;
+}
+mullow_task_t;
+
+typedef struct
+{
+    mullow_task_t * tasks;
+    slong start;
+    slong stop;
+    slong step;
+    slong n;
+    slong prec;
+}
+mullow_arg_t;
+
+static void
+_mullow_task(const mullow_task_t * task, slong n, slong prec)
+{
+    _acb_poly_mullow(task->res, task->x, n, task->y, n, n, prec);
+
+    if (task->c != NULL)
+        _acb_vec_add(task->res, task->res, task->c, n, prec);
+}
+
+static void *
+_mullow_worker(void * arg_ptr)
+{
+    mullow_arg_t arg = *((mullow_arg_t *) arg_ptr);
+    slong i;
+
+    for (i = arg.start; i < arg.stop; i += arg.step)
+        _mullow_task(arg.tasks + i, arg.n, arg.prec);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/* performs independent multiplications in parallel */
+static void
+_mullow_tasks(mullow_task_t * tasks, slong num, slong n, slong prec)
+{
+    pthread_t * threads;
+    mullow_arg_t * args;
+    slong i, num_threads;
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), num);
+
+    if (num_threads <= 1)
+    {
+        for (i = 0; i < num; i++)
+            _mullow_task(tasks + i, n, prec);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(mullow_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].tasks = tasks;
+        args[i].start = i;
+        args[i].stop = num;
+        args[i].step = num_threads;
+        args[i].n = n;
+        args[i].prec = prec;
+        pthread_create(&threads[i], NULL, _mullow_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
+/* Computes sum_{i<m} C[i] h^i using Estrin's scheme: all multiplications
+   at each level are independent and are done in parallel. */
+static void
+_acb_poly_block_estrin_threaded(acb_ptr res, acb_ptr * C, slong m,
+    acb_srcptr h, slong n, slong prec)
+{
+    mullow_task_t * tasks;
+    acb_ptr V, W, H, T;
+    slong i, len;
+
+    V = _acb_vec_init(m * n);
+    W = _acb_vec_init(((m + 1) / 2) * n);
+    H = _acb_vec_init(n);
+    T = _acb_vec_init(n);
+    tasks = flint_malloc(sizeof(mullow_task_t) * m);
+
+    for (i = 0; i < m; i++)
+        _acb_vec_set(V + i * n, C[i], n);
+
+    _acb_vec_set(H, h, n);
+
+    for (len = m; len > 1; len = (len + 1) / 2)
+    {
+        for (i = 0; i < len / 2; i++)
+        {
+            tasks[i].res = W + i * n;
+            tasks[i].x = V + (2 * i + 1) * n;
+            tasks[i].y = H;
+            tasks[i].c = V + (2 * i) * n;
+        }
+
+        _mullow_tasks(tasks, len / 2, n, prec);
+
+        if (len % 2)
+            _acb_vec_set(W + (len / 2) * n, V + (len - 1) * n, n);
+
+        for (i = 0; i < (len + 1) / 2; i++)
+            _acb_vec_swap(V + i * n, W + i * n, n);
+
+        if (len > 2)
+        {
+            _acb_poly_mullow(T, H, n, H, n, n, prec);
+            _acb_vec_swap(H, T, n);
+        }
+    }
+
+    _acb_vec_set(res, V, n);
+
+    _acb_vec_clear(V, m * n);
+    _acb_vec_clear(W, ((m + 1) / 2) * n);
+    _acb_vec_clear(H, n);
+    _acb_vec_clear(T, n);
+    flint_free(tasks);
+}
+
 void
 _acb_poly_compose_series_brent_kung(acb_ptr res,
     acb_srcptr poly1, slong len1,
@@ -34,6 +174,7 @@ _acb_poly_compose_series_brent_kung(acb_ptr res,
     acb_mat_t A, B, C;
     acb_ptr t, h;
     slong i, m;
+    int threaded;
 
     if (n == 1)
     {
@@ -42,6 +183,7 @@ _acb_poly_compose_series_brent_kung(acb_ptr res,
     }
 
     m = n_sqrt(n) + 1;
+    threaded = (flint_get_num_threads() > 1 && n >= THREADED_CUTOFF);
 
     acb_mat_init(A, m, n);
     acb_mat_init(B, m, m);
@@ -58,19 +200,58 @@ _acb_poly_compose_series_brent_kung(acb_ptr res,
     /* Set rows of A to powers of poly2 */
     acb_set_ui(A->rows[0] + 0, UWORD(1));
     _acb_vec_set(A->rows[1], poly2, len2);
-    for (i = 2; i < m; i++)
-        _acb_poly_mullow(A->rows[i], A->rows[(i + 1) / 2], n, A->rows[i / 2], n, n, prec);
 
+    if (threaded)
+    {
+        mullow_task_t * tasks;
+        slong lo, hi;
+
+        /* the powers i in (2^k, 2^(k+1)] only depend on lower powers */
+        tasks = flint_malloc(sizeof(mullow_task_t) * m);
+
+        for (lo = 2; lo < m; lo = hi)
+        {
+            hi = FLINT_MIN(2 * lo - 1, m);
+
+            for (i = lo; i < hi; i++)
+            {
+                tasks[i - lo].res = A->rows[i];
+                tasks[i - lo].x = A->rows[(i + 1) / 2];
+                tasks[i - lo].y = A->rows[i / 2];
+                tasks[i - lo].c = NULL;
+            }
+
+            _mullow_tasks(tasks, hi - lo, n, prec);
+        }
+
+        flint_free(tasks);
+    }
+    else
+    {
+        for (i = 2; i < m; i++)
+            _acb_poly_mullow(A->rows[i], A->rows[(i + 1) / 2], n, A->rows[i / 2], n, n, prec);
+    }
+
+    /* all the baby step products as one matrix multiplication
+       (which is threaded by acb_mat_mul) */
     acb_mat_mul(C, B, A, prec);
 
-    /* Evaluate block composition using the Horner scheme */
-    _acb_vec_set(res, C->rows[m - 1], n);
     _acb_poly_mullow(h, A->rows[m - 1], n, poly2, len2, n, prec);
 
-    for (i = m - 2; i >= 0; i--)
+    if (threaded)
     {
-        _acb_poly_mullow(t, res, n, h, n, n, prec);
-        _acb_poly_add(res, t, n, C->rows[i], n, prec);
+        _acb_poly_block_estrin_threaded(res, C->rows, m, h, n, prec);
+    }
+    else
+    {
+        /* Evaluate block composition using the Horner scheme */
+        _acb_vec_set(res, C->rows[m - 1], n);
+
+        for (i = m - 2; i >= 0; i--)
+        {
+            _acb_poly_mullow(t, res, n, h, n, n, prec);
+            _acb_poly_add(res, t, n, C->rows[i], n, prec);
+        }
     }
 
     _acb_vec_clear(h, n);
@@ -25,6 +25,9 @@
 
 #include "acb_poly.h"
 
+/* use the Aberth method instead of Durand-Kerner above this degree */
+#define ABERTH_CUTOFF 16
+
 slong
 _acb_get_mid_mag(const acb_t z)
 {
@@ -81,13 +84,62 @@ _acb_poly_roots_initial_values(acb_ptr roots, slong deg, slong prec)
     }
 }
 
+/* performs at most maxiter steps, terminating early if the estimated
+   accuracy of the roots approaches the working precision; returns the
+   number of steps performed */
+static slong
+_acb_poly_find_roots_iter(acb_ptr roots, acb_srcptr poly, acb_srcptr deriv,
+    slong len, slong maxiter, slong prec)
+{
+    slong iter, i, deg;
+    slong rootmag, max_rootmag, correction, max_correction;
+
+    deg = len - 1;
+
+    for (iter = 0; iter < maxiter; iter++)
+    {
+        max_rootmag = -ARF_PREC_EXACT;
+        for (i = 0; i < deg; i++)
+        {
+            rootmag = _acb_get_mid_mag(roots + i);
+            max_rootmag = FLINT_MAX(rootmag, max_rootmag);
+        }
+
+        if (deriv != NULL)
+            _acb_poly_refine_roots_aberth(roots, poly, deriv, len, prec);
+        else
+            _acb_poly_refine_roots_durand_kerner(roots, poly, len, prec);
+
+        max_correction = -ARF_PREC_EXACT;
+        for (i = 0; i < deg; i++)
+        {
+            correction = _acb_get_rad_mag(roots + i);
+            max_correction = FLINT_MAX(correction, max_correction);
+        }
+
+        /* estimate the correction relative to the whole set of roots */
+        max_correction -= max_rootmag;
+
+        /* flint_printf("ITER %wd MAX CORRECTION: %wd\n", iter, max_correction); */
+
+        if (max_correction < -prec / 2)
+            maxiter = FLINT_MIN(maxiter, iter + 2);
+        else if (max_correction < -prec / 3)
+            maxiter = FLINT_MIN(maxiter, iter + 3);
+        else if (max_correction < -prec / 4)
+            maxiter = FLINT_MIN(maxiter, iter + 4);
+    }
+
+    return iter;
+}
+
 slong
 _acb_poly_find_roots(acb_ptr roots,
     acb_srcptr poly,
     acb_srcptr initial, slong len, slong maxiter, slong prec)
 {
-    slong iter, i, deg;
-    slong rootmag, max_rootmag, correction, max_correction;
+    slong i, deg, wp, used;
+    acb_ptr deriv;
 
     deg = len - 1;
 
@@ -113,44 +165,47 @@ _acb_poly_find_roots(acb_ptr roots,
         return 1;
     }
 
-    if (initial == NULL)
-        _acb_poly_roots_initial_values(roots, deg, prec);
+    if (deg >= ABERTH_CUTOFF)
+    {
+        deriv = _acb_vec_init(deg);
+        _acb_poly_derivative(deriv, poly, len, prec);
+    }
     else
-        _acb_vec_set(roots, initial, deg);
+    {
+        deriv = NULL;
+    }
 
     if (maxiter == 0)
         maxiter = 2 * deg + n_sqrt(prec);
 
-    for (iter = 0; iter < maxiter; iter++)
-    {
-        max_rootmag = -ARF_PREC_EXACT;
-        for (i = 0; i < deg; i++)
-        {
-            rootmag = _acb_get_mid_mag(roots + i);
-            max_rootmag = FLINT_MAX(rootmag, max_rootmag);
-        }
+    used = 0;
 
-        _acb_poly_refine_roots_durand_kerner(roots, poly, len, prec);
-
-        max_correction = -ARF_PREC_EXACT;
-        for (i = 0; i < deg; i++)
-        {
-            correction = _acb_get_rad_mag(roots + i);
-            max_correction = FLINT_MAX(correction, max_correction);
-        }
-
-        /* estimate the correction relative to the whole set of roots */
-        max_correction -= max_rootmag;
+    if (initial != NULL)
+    {
+        _acb_vec_set(roots, initial, deg);
+    }
+    else if ((used = _acb_poly_find_roots_d(roots, poly, len,
+                maxiter / 2)) >= 0)
+    {
+        /* warm start: the roots are now approximated to about double
+           precision; refine them while doubling the working precision,
+           so that only the last few steps are done at full precision.
+           The double precision steps and the intermediate precisions
+           (a few steps each) together take at most half of the budget. */
+        for (wp = 2 * 53; wp < prec && used < maxiter / 2; wp *= 2)
+            used += _acb_poly_find_roots_iter(roots, poly, deriv, len,
+                FLINT_MIN(4, maxiter / 2 - used), wp);
+    }
+    else
+    {
+        _acb_poly_roots_initial_values(roots, deg, prec);
+        used = 0;
+    }
 
-        /* flint_printf("ITER %wd MAX CORRECTION: %wd\n", iter, max_correction); */
+    _acb_poly_find_roots_iter(roots, poly, deriv, len, maxiter - used, prec);
 
-        if (max_correction < -prec / 2)
-            maxiter = FLINT_MIN(maxiter, iter + 2);
-        else if (max_correction < -prec / 3)
-            maxiter = FLINT_MIN(maxiter, iter + 3);
-        else if (max_correction < -prec / 4)
-            maxiter = FLINT_MIN(maxiter, iter + 4);
-    }
+    if (deriv != NULL)
+        _acb_vec_clear(deriv, deg);
 
     return _acb_poly_validate_roots(roots, poly, len, prec);
 }
@@ -0,0 +1,251 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+
+#include <math.h>
+#include "acb_poly.h"
+
+/* stop when all corrections are this small relative to the roots */
+#define D_TOL 1e-14
+
+/* Sets (qr, qi) to p(z) / p'(z), where p has real and imaginary
+   parts of coefficients (pr, pi). For |z| > 1, the reversed
+   polynomial is evaluated at 1/z to avoid overflow. */
+static void
+_newton_ratio_d(double * qr, double * qi,
+    const double * pr, const double * pi, slong len, double zr, double zi)
+{
+    double ar, ai, br, bi, cr, ci, wr, wi, t, den;
+    slong k, n;
+
+    n = len - 1;
+
+    if (zr * zr + zi * zi <= 1.0)
+    {
+        /* a = p(z), b = p'(z) */
+        ar = pr[n];
+        ai = pi[n];
+        br = bi = 0.0;
+
+        for (k = n - 1; k >= 0; k--)
+        {
+            t = br * zr - bi * zi + ar;
+            bi = br * zi + bi * zr + ai;
+            br = t;
+
+            t = ar * zr - ai * zi + pr[k];
+            ai = ar * zi + ai * zr + pi[k];
+            ar = t;
+        }
+    }
+    else
+    {
+        /* w = 1/z, a = rev(p)(w), c = rev(p)'(w) */
+        den = zr * zr + zi * zi;
+        wr = zr / den;
+        wi = -zi / den;
+
+        ar = pr[0];
+        ai = pi[0];
+        cr = ci = 0.0;
+
+        for (k = 1; k <= n; k++)
+        {
+            t = cr * wr - ci * wi + ar;
+            ci = cr * wi + ci * wr + ai;
+            cr = t;
+
+            t = ar * wr - ai * wi + pr[k];
+            ai = ar * wi + ai * wr + pi[k];
+            ar = t;
+        }
+
+        /* p(z) / p'(z) = z a / (n a - w c) */
+        br = n * ar - (wr * cr - wi * ci);
+        bi = n * ai - (wr * ci + wi * cr);
+
+        t = ar * zr - ai * zi;
+        ai = ar * zi + ai * zr;
+        ar = t;
+    }
+
+    den = br * br + bi * bi;
+    *qr = (ar * br + ai * bi) / den;
+    *qi = (ai * br - ar * bi) / den;
+}
+
+slong
+_acb_poly_find_roots_d(acb_ptr roots, acb_srcptr poly, slong len,
+    slong maxiter)
+{
+    double *pr, *pi, *zr, *zi, *cr, *ci;
+    double R, sr, si, tr, ti, den, maxcorr, maxmag;
+    slong i, j, iter, deg, emax, e, steps;
+    arf_t t;
+    mag_t b;
+
+    deg = len - 1;
+
+    if (deg < 1)
+        return 0;
+
+    pr = flint_malloc(sizeof(double) * len);
+    pi = flint_malloc(sizeof(double) * len);
+    zr = flint_malloc(sizeof(double) * deg);
+    zi = flint_malloc(sizeof(double) * deg);
+    cr = flint_malloc(sizeof(double) * deg);
+    ci = flint_malloc(sizeof(double) * deg);
+
+    arf_init(t);
+    mag_init(b);
+
+    steps = -1;
+
+    /* scale the coefficients so that the largest has magnitude about 1;
+       smaller coefficients may harmlessly underflow to zero */
+    emax = -ARF_PREC_EXACT;
+    for (i = 0; i < len; i++)
+    {
+        e = arf_abs_bound_lt_2exp_si(arb_midref(acb_realref(poly + i)));
+        emax = FLINT_MAX(emax, e);
+        e = arf_abs_bound_lt_2exp_si(arb_midref(acb_imagref(poly + i)));
+        emax = FLINT_MAX(emax, e);
+    }
+
+    if (emax == -ARF_PREC_EXACT || emax == ARF_PREC_EXACT)
+        goto cleanup;
+
+    for (i = 0; i < len; i++)
+    {
+        arf_mul_2exp_si(t, arb_midref(acb_realref(poly + i)), -emax);
+        pr[i] = arf_get_d(t, ARF_RND_NEAR);
+        arf_mul_2exp_si(t, arb_midref(acb_imagref(poly + i)), -emax);
+        pi[i] = arf_get_d(t, ARF_RND_NEAR);
+    }
+
+    if (pr[deg] == 0.0 && pi[deg] == 0.0)
+        goto cleanup;
+
+    /* initial values on a circle enclosing the roots, rotated
+       so as to avoid symmetric configurations */
+    _acb_poly_root_bound_fujiwara(b, poly, len);
+    R = 0.5 * mag_get_d(b);
+
+    if (!(R > 1e-300 && R < 1e300))
+        goto cleanup;
+
+    for (i = 0; i < deg; i++)
+    {
+        zr[i] = R * cos(2 * 3.141592653589793 * i / deg + 0.4);
+        zi[i] = R * sin(2 * 3.141592653589793 * i / deg + 0.4);
+    }
+
+    for (iter = 0; iter < maxiter; iter++)
+    {
+        /* Aberth corrections, all computed from the old roots; the inner
+           loops are split at j = i so that they can be vectorized */
+        for (i = 0; i < deg; i++)
+        {
+            _newton_ratio_d(&tr, &ti, pr, pi, len, zr[i], zi[i]);
+
+            sr = si = 0.0;
+
+            for (j = 0; j < i; j++)
+            {
+                double dr = zr[i] - zr[j];
+                double di = zi[i] - zi[j];
+                double dd = dr * dr + di * di;
+                sr += dr / dd;
+                si -= di / dd;
+            }
+
+            for (j = i + 1; j < deg; j++)
+            {
+                double dr = zr[i] - zr[j];
+                double di = zi[i] - zi[j];
+                double dd = dr * dr + di * di;
+                sr += dr / dd;
+                si -= di / dd;
+            }
+
+            /* c = t / (1 - t s) */
+            den = 1.0 - (tr * sr - ti * si);
+            sr = -(tr * si + ti * sr);
+            si = den;
+            den = si * si + sr * sr;
+
+            if (den == 0.0)
+            {
+                cr[i] = tr;
+                ci[i] = ti;
+            }
+            else
+            {
+                cr[i] = (tr * si + ti * sr) / den;
+                ci[i] = (ti * si - tr * sr) / den;
+            }
+        }
+
+        maxcorr = maxmag = 0.0;
+
+        for (i = 0; i < deg; i++)
+        {
+            zr[i] -= cr[i];
+            zi[i] -= ci[i];
+
+            tr = fabs(cr[i]) + fabs(ci[i]);
+            ti = fabs(zr[i]) + fabs(zi[i]);
+
+            /* give up on overflow or nan */
+            if (!(tr < 1e300 && ti < 1e300))
+                goto cleanup;
+
+            maxcorr = FLINT_MAX(maxcorr, tr);
+            maxmag = FLINT_MAX(maxmag, ti);
+        }
+
+        if (maxcorr < D_TOL * maxmag)
+            break;
+    }
+
+    for (i = 0; i < deg; i++)
+        acb_set_d_d(roots + i, zr[i], zi[i]);
+
+    /* the loop stopped after step iter + 1, or ran out at maxiter */
+    steps = FLINT_MAX(0, FLINT_MIN(iter + 1, maxiter));
+
+cleanup:
+    flint_free(pr);
+    flint_free(pi);
+    flint_free(zr);
+    flint_free(zi);
+    flint_free(cr);
+    flint_free(ci);
+
+    arf_clear(t);
+    mag_clear(b);
+
+    return steps;
+}
@@ -0,0 +1,331 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include <pthread.h>
+#include "acb_poly.h"
+
+#define POWER(_k) (arg.powers + (((_k)-1)/2) * (arg.len))
+#define DIVISOR(_k) (arg.divisors[((_k)-1)/2])
+
+typedef struct
+{
+    acb_ptr z;
+    acb_ptr powers;
+    const slong * divisors;
+    acb_srcptr s;
+    slong n;
+    slong k0;
+    slong k1;
+    slong len;
+    slong prec;
+    int integer;
+    int critical_line;
+}
+powsum_arg_t;
+
+/* t = k^(-(s+x)) as a power series in x, given logk = log(k)
+   (which is not read if s is an integer and len = 1) */
+static void
+compute_power(acb_ptr t, const acb_t s, ulong k, const arb_t logk,
+    slong len, int integer, int critical_line, slong prec)
+{
+    arb_t v, w;
+    slong i;
+
+    arb_init(v);
+    arb_init(w);
+
+    if (integer)
+    {
+        arb_neg(w, acb_realref(s));
+        arb_set_ui(v, k);
+        arb_pow(acb_realref(t), v, w, prec);
+        arb_zero(acb_imagref(t));
+    }
+    else
+    {
+        arb_mul(w, logk, acb_imagref(s), prec);
+        arb_neg(w, w);
+        arb_sin_cos(acb_imagref(t), acb_realref(t), w, prec);
+
+        if (critical_line)
+        {
+            arb_rsqrt_ui(w, k, prec);
+        }
+        else
+        {
+            arb_mul(w, acb_realref(s), logk, prec);
+            arb_neg(w, w);
+            arb_exp(w, w, prec);
+        }
+
+        acb_mul_arb(t, t, w, prec);
+    }
+
+    if (len != 1)
+    {
+        arb_neg(v, logk);
+
+        for (i = 1; i < len; i++)
+        {
+            acb_mul_arb(t + i, t + i - 1, v, prec);
+            acb_div_ui(t + i, t + i, i, prec);
+        }
+    }
+
+    arb_clear(v);
+    arb_clear(w);
+}
+
+/* powers of the odd primes in [k0, k1) */
+static void *
+prime_worker(void * arg_ptr)
+{
+    powsum_arg_t arg = *((powsum_arg_t *) arg_ptr);
+    slong k, kprev;
+    arb_t logk;
+
+    arb_init(logk);
+    kprev = 0;
+
+    for (k = arg.k0; k < arg.k1; k += 2)
+    {
+        if (DIVISOR(k) == 0)
+        {
+            if (!arg.integer || arg.len != 1)
+            {
+                arb_log_ui_from_prev(logk, k, logk, kprev, arg.prec);
+                kprev = k;
+            }
+
+            compute_power(POWER(k), arg.s, k, logk, arg.len,
+                arg.integer, arg.critical_line, arg.prec);
+        }
+    }
+
+    arb_clear(logk);
+    flint_cleanup();
+    return NULL;
+}
+
+/* powers of the odd composites in [k0, k1), assuming that the
+   powers of all odd k <= k0 / 3 are known */
+static void *
+composite_worker(void * arg_ptr)
+{
+    powsum_arg_t arg = *((powsum_arg_t *) arg_ptr);
+    slong k;
+
+    for (k = arg.k0; k < arg.k1; k += 2)
+    {
+        if (DIVISOR(k) != 0)
+        {
+            if (arg.len == 1)
+                acb_mul(POWER(k), POWER(DIVISOR(k)),
+                    POWER(k / DIVISOR(k)), arg.prec);
+            else
+                _acb_poly_mullow(POWER(k), POWER(DIVISOR(k)), arg.len,
+                    POWER(k / DIVISOR(k)), arg.len, arg.len, arg.prec);
+        }
+    }
+
+    flint_cleanup();
+    return NULL;
+}
+
+/* adds k^(-(s+x)) for odd k in [k0, k1) to the bucket z[i], where
+   n / 2^(i+1) < k <= n / 2^i */
+static void *
+sum_worker(void * arg_ptr)
+{
+    powsum_arg_t arg = *((powsum_arg_t *) arg_ptr);
+    slong k, kprev, bucket;
+    acb_ptr t, u;
+    arb_t logk;
+
+    t = _acb_vec_init(arg.len);
+    arb_init(logk);
+    kprev = 0;
+
+    for (k = arg.k0; k < arg.k1; k += 2)
+    {
+        if (3 * k <= arg.n)
+        {
+            u = POWER(k);
+        }
+        else if (DIVISOR(k) == 0)
+        {
+            if (!arg.integer || arg.len != 1)
+            {
+                arb_log_ui_from_prev(logk, k, logk, kprev, arg.prec);
+                kprev = k;
+            }
+
+            compute_power(t, arg.s, k, logk, arg.len,
+                arg.integer, arg.critical_line, arg.prec);
+            u = t;
+        }
+        else
+        {
+            if (arg.len == 1)
+                acb_mul(t, POWER(DIVISOR(k)), POWER(k / DIVISOR(k)), arg.prec);
+            else
+                _acb_poly_mullow(t, POWER(DIVISOR(k)), arg.len,
+                    POWER(k / DIVISOR(k)), arg.len, arg.len, arg.prec);
+            u = t;
+        }
+
+        bucket = FLINT_BIT_COUNT(arg.n / k) - 1;
+        _acb_vec_add(arg.z + bucket * arg.len, arg.z + bucket * arg.len,
+            u, arg.len, arg.prec);
+    }
+
+    _acb_vec_clear(t, arg.len);
+    arb_clear(logk);
+    flint_cleanup();
+    return NULL;
+}
+
+/* runs worker on the odd k with lo <= k <= hi split evenly over
+   the threads */
+static void
+run_threads(void * (*worker)(void *), powsum_arg_t * args,
+    pthread_t * threads, slong num_threads, slong lo, slong hi)
+{
+    slong i, count;
+
+    if (hi < lo)
+        return;
+
+    count = (hi - lo) / 2 + 1;
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].k0 = lo + 2 * ((count * i) / num_threads);
+        args[i].k1 = lo + 2 * ((count * (i + 1)) / num_threads);
+        pthread_create(&threads[i], NULL, worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+}
+
+void
+_acb_poly_powsum_one_series_sieved_threaded(acb_ptr z, const acb_t s,
+    slong n, slong len, slong prec)
+{
+    pthread_t * threads;
+    powsum_arg_t * args;
+    slong * divisors;
+    slong i, j, ibound, num_threads, num_buckets, powers_alloc, K;
+    int critical_line, integer;
+    acb_ptr powers, buckets, t, u, x;
+    arb_t log2;
+
+    _acb_vec_zero(z, len);
+
+    if (n < 1)
+        return;
+
+    num_threads = flint_get_num_threads();
+    num_buckets = FLINT_BIT_COUNT(n);
+
+    critical_line = arb_is_exact(acb_realref(s)) &&
+        (arf_cmp_2exp_si(arb_midref(acb_realref(s)), -1) == 0);
+
+    integer = arb_is_zero(acb_imagref(s)) && arb_is_int(acb_realref(s));
+
+    divisors = flint_calloc(n / 2 + 1, sizeof(slong));
+    powers_alloc = (n / 6 + 1) * len;
+    powers = _acb_vec_init(powers_alloc);
+
+    ibound = n_sqrt(n);
+    for (i = 3; i <= ibound; i += 2)
+        if (divisors[(i - 1) / 2] == 0)
+            for (j = i * i; j <= n; j += 2 * i)
+                divisors[(j - 1) / 2] = i;
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(powsum_arg_t) * num_threads);
+    buckets = _acb_vec_init(num_threads * num_buckets * len);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].z = buckets + i * num_buckets * len;
+        args[i].powers = powers;
+        args[i].divisors = divisors;
+        args[i].s = s;
+        args[i].n = n;
+        args[i].len = len;
+        args[i].prec = prec;
+        args[i].integer = integer;
+        args[i].critical_line = critical_line;
+    }
+
+    /* powers of the primes k <= n / 3 */
+    run_threads(prime_worker, args, threads, num_threads, 1, n / 3);
+
+    /* powers of the composites k <= n / 3, in rounds (K, 3K] */
+    for (K = 1; K < n / 3; K *= 3)
+        run_threads(composite_worker, args, threads, num_threads,
+            (K + 1) | 1, FLINT_MIN(3 * K, n / 3));
+
+    /* sums over the odd k in each bucket (n / 2^(i+1), n / 2^i] */
+    run_threads(sum_worker, args, threads, num_threads, 1, n);
+
+    t = _acb_vec_init(len);
+    u = _acb_vec_init(len);
+    x = _acb_vec_init(len);
+    arb_init(log2);
+
+    /* x = 2^(-(s+t)) */
+    if (!integer || len != 1)
+        arb_log_ui(log2, 2, prec);
+    compute_power(x, s, 2, log2, len, integer, critical_line, prec);
+
+    /* z = S_0 + x (S_1 + x (S_2 + ...)) where S_j = sum of the buckets
+       i >= j is the sum over odd k <= n / 2^j */
+    for (j = num_buckets - 1; j >= 0; j--)
+    {
+        for (i = 0; i < num_threads; i++)
+            _acb_vec_add(u, u, buckets + (i * num_buckets + j) * len,
+                len, prec);
+
+        _acb_poly_mullow(t, z, len, x, len, len, prec);
+        _acb_vec_add(z, t, u, len, prec);
+    }
+
+    _acb_vec_clear(t, len);
+    _acb_vec_clear(u, len);
+    _acb_vec_clear(x, len);
+    arb_clear(log2);
+
+    _acb_vec_clear(buckets, num_threads * num_buckets * len);
+    _acb_vec_clear(powers, powers_alloc);
+    flint_free(divisors);
+    flint_free(threads);
+    flint_free(args);
+}
+
@@ -50,7 +50,8 @@ _acb_poly_powsum_series_naive(acb_ptr z,
     const acb_t s, const acb_t a, const acb_t q, slong n, slong len, slong prec)
 {
     slong k, i;
-    int q_one, s_int;
+    ulong a0;
+    int q_one, s_int, a_int;
     acb_t ak, logak, t, qpow, negs;
 
     acb_init(ak);
@@ -66,6 +67,16 @@ _acb_poly_powsum_series_naive(acb_ptr z,
     q_one = acb_is_one(q);
     s_int = arb_is_int(acb_realref(s)) && arb_is_zero(acb_imagref(s));
 
+    /* for a small positive integer a, get log(a+k) from log(a+k-1) */
+    a0 = 0;
+    a_int = len != 1 && acb_is_real(a) && arb_is_int(acb_realref(a)) &&
+        arf_sgn(arb_midref(acb_realref(a))) > 0 &&
+        arf_cmpabs_2exp_si(arb_midref(acb_realref(a)), FLINT_BITS - 4) < 0 &&
+        n < (WORD(1) << (FLINT_BITS - 4));
+
+    if (a_int)
+        a0 = arf_get_si(arb_midref(acb_realref(a)), ARF_RND_DOWN);
+
     for (k = 0; k < n; k++)
     {
         acb_add_ui(ak, a, k, prec);
@@ -76,7 +87,16 @@ _acb_poly_powsum_series_naive(acb_ptr z,
         }
         else
         {
-            acb_log(logak, ak, prec);
+            if (a_int)
+            {
+                arb_log_ui_from_prev(acb_realref(logak), a0 + k,
+                    acb_realref(logak), (k == 0) ? 0 : a0 + k - 1, prec);
+                arb_zero(acb_imagref(logak));
+            }
+            else
+            {
+                acb_log(logak, ak, prec);
+            }
 
             if (s_int)
             {
@@ -0,0 +1,354 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+
+#include <pthread.h>
+#include "acb_poly.h"
+
+/* use fast multipoint evaluation for p and p' above this degree */
+#define MULTIPOINT_CUTOFF 128
+
+/* use threads above this degree */
+#define THREADED_CUTOFF 64
+
+/* values of p' from fast multipoint evaluation with fewer accurate bits
+   than this are recomputed using Horner's rule */
+#define MULTIPOINT_MIN_BITS 16
+
+/* as in the Durand-Kerner code, we don't need any error bounding */
+
+static __inline__ int
+acb_mid_is_zero(const acb_t z)
+{
+    return arf_is_zero(arb_midref(acb_realref(z)))
+        && arf_is_zero(arb_midref(acb_imagref(z)));
+}
+
+static __inline__ void
+acb_sub_mid(acb_t z, const acb_t x, const acb_t y, slong prec)
+{
+    arf_sub(arb_midref(acb_realref(z)),
+        arb_midref(acb_realref(x)),
+        arb_midref(acb_realref(y)), prec, ARF_RND_DOWN);
+    arf_sub(arb_midref(acb_imagref(z)),
+        arb_midref(acb_imagref(x)),
+        arb_midref(acb_imagref(y)), prec, ARF_RND_DOWN);
+}
+
+static __inline__ void
+acb_add_mid(acb_t z, const acb_t x, const acb_t y, slong prec)
+{
+    arf_add(arb_midref(acb_realref(z)),
+        arb_midref(acb_realref(x)),
+        arb_midref(acb_realref(y)), prec, ARF_RND_DOWN);
+    arf_add(arb_midref(acb_imagref(z)),
+        arb_midref(acb_imagref(x)),
+        arb_midref(acb_imagref(y)), prec, ARF_RND_DOWN);
+}
+
+static __inline__ void
+acb_mul_mid(acb_t z, const acb_t x, const acb_t y, slong prec)
+{
+    arf_complex_mul(arb_midref(acb_realref(z)), arb_midref(acb_imagref(z)),
+        arb_midref(acb_realref(x)), arb_midref(acb_imagref(x)),
+        arb_midref(acb_realref(y)), arb_midref(acb_imagref(y)),
+        prec, ARF_RND_DOWN);
+}
+
+static __inline__ void
+acb_inv_mid(acb_t z, const acb_t x, slong prec)
+{
+    arf_t t;
+    arf_init(t);
+
+#define a arb_midref(acb_realref(x))
+#define b arb_midref(acb_imagref(x))
+#define e arb_midref(acb_realref(z))
+#define f arb_midref(acb_imagref(z))
+
+    arf_mul(t, a, a, prec, ARF_RND_DOWN);
+    arf_addmul(t, b, b, prec, ARF_RND_DOWN);
+
+    arf_div(e, a, t, prec, ARF_RND_DOWN);
+    arf_div(f, b, t, prec, ARF_RND_DOWN);
+
+    arf_neg(f, f);
+
+#undef a
+#undef b
+#undef e
+#undef f
+
+    arf_clear(t);
+}
+
+/* Close to a root, p(z) is tiny and has few accurate bits whichever way
+   it is evaluated, so its relative accuracy says nothing. What matters
+   is that the error of the Newton step p(z)/p'(z) is below the ulp of z
+   at the working precision; the value from fast multipoint evaluation
+   is only recomputed with Horner's rule otherwise. */
+static int
+_acb_poly_aberth_value_accurate(const acb_t p, const acb_t q,
+    const acb_t z, slong prec)
+{
+    mag_t err, t;
+    int res;
+
+    if (acb_rel_accuracy_bits(p) >= MULTIPOINT_MIN_BITS)
+        return 1;
+
+    mag_init(err);
+    mag_init(t);
+
+    mag_hypot(err, arb_radref(acb_realref(p)), arb_radref(acb_imagref(p)));
+    mag_mul_2exp_si(err, err, prec);
+    acb_get_mag_lower(t, q);
+    mag_div(err, err, t);
+    acb_get_mag(t, z);
+    res = (mag_cmp(err, t) <= 0);
+
+    mag_clear(err);
+    mag_clear(t);
+
+    return res;
+}
+
+/* Computes the Aberth corrections for the roots with index i0 <= i < i1.
+   If vals and dvals are not NULL, they are assumed to contain
+   (possibly inaccurate) values of p and p' at all the roots. */
+static void
+_acb_poly_aberth_corrections(acb_ptr corr, acb_srcptr roots,
+    acb_srcptr poly, acb_srcptr deriv, acb_srcptr vals, acb_srcptr dvals,
+    slong len, slong i0, slong i1, slong prec)
+{
+    slong i, j, deg;
+    acb_t p, q, s, t;
+
+    deg = len - 1;
+
+    acb_init(p);
+    acb_init(q);
+    acb_init(s);
+    acb_init(t);
+
+    for (i = i0; i < i1; i++)
+    {
+        if (dvals != NULL && acb_rel_accuracy_bits(dvals + i) >= MULTIPOINT_MIN_BITS)
+            acb_set(q, dvals + i);
+        else
+            _acb_poly_evaluate_mid(q, deriv, deg, roots + i, prec);
+
+        if (vals != NULL &&
+                _acb_poly_aberth_value_accurate(vals + i, q, roots + i, prec))
+            acb_set(p, vals + i);
+        else
+            _acb_poly_evaluate_mid(p, poly, len, roots + i, prec);
+
+        if (acb_mid_is_zero(p) || acb_mid_is_zero(q))
+        {
+            acb_zero(corr + i);
+            continue;
+        }
+
+        /* t = p(z_i) / p'(z_i) */
+        acb_inv_mid(t, q, prec);
+        acb_mul_mid(t, t, p, prec);
+
+        /* s = sum_{j != i} 1 / (z_i - z_j) */
+        acb_zero(s);
+        for (j = 0; j < deg; j++)
+        {
+            if (i != j)
+            {
+                acb_sub_mid(q, roots + i, roots + j, prec);
+                acb_inv_mid(q, q, prec);
+                acb_add_mid(s, s, q, prec);
+            }
+        }
+
+        /* correction = t / (1 - t s) */
+        acb_mul_mid(s, s, t, prec);
+        acb_one(q);
+        acb_sub_mid(q, q, s, prec);
+
+        if (acb_mid_is_zero(q))
+        {
+            acb_set(corr + i, t);
+        }
+        else
+        {
+            acb_inv_mid(q, q, prec);
+            acb_mul_mid(corr + i, t, q, prec);
+        }
+    }
+
+    acb_clear(p);
+    acb_clear(q);
+    acb_clear(s);
+    acb_clear(t);
+}
+
+typedef struct
+{
+    acb_ptr corr;
+    acb_srcptr roots;
+    acb_srcptr poly;
+    acb_srcptr deriv;
+    acb_srcptr vals;
+    acb_srcptr dvals;
+    slong len;
+    slong i0;
+    slong i1;
+    slong prec;
+}
+aberth_arg_t;
+
+static void *
+_acb_poly_aberth_thread(void * arg_ptr)
+{
+    aberth_arg_t arg = *((aberth_arg_t *) arg_ptr);
+
+    _acb_poly_aberth_corrections(arg.corr, arg.roots, arg.poly, arg.deriv,
+        arg.vals, arg.dvals, arg.len, arg.i0, arg.i1, arg.prec);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+_acb_poly_refine_roots_aberth(acb_ptr roots, acb_srcptr poly,
+    acb_srcptr deriv, slong len, slong prec)
+{
+    acb_ptr corr, vals, dvals;
+    slong i, deg, num_threads;
+
+    deg = len - 1;
+
+    if (deg < 1)
+        return;
+
+    corr = _acb_vec_init(deg);
+    vals = dvals = NULL;
+
+    if (deg >= MULTIPOINT_CUTOFF)
+    {
+        acb_ptr * tree;
+        acb_ptr xs, pmid;
+        slong wp;
+
+        /* the subproduct tree loses bits to cancellation; evaluating
+           at twice the precision keeps most values usable */
+        wp = 2 * prec;
+
+        xs = _acb_vec_init(deg);
+        pmid = _acb_vec_init(len + deg);
+        vals = _acb_vec_init(deg);
+        dvals = _acb_vec_init(deg);
+
+        for (i = 0; i < deg; i++)
+        {
+            arf_set(arb_midref(acb_realref(xs + i)), arb_midref(acb_realref(roots + i)));
+            arf_set(arb_midref(acb_imagref(xs + i)), arb_midref(acb_imagref(roots + i)));
+        }
+
+        /* only rounding errors should show up in the radii */
+        for (i = 0; i < len; i++)
+        {
+            arf_set(arb_midref(acb_realref(pmid + i)), arb_midref(acb_realref(poly + i)));
+            arf_set(arb_midref(acb_imagref(pmid + i)), arb_midref(acb_imagref(poly + i)));
+        }
+
+        for (i = 0; i < deg; i++)
+        {
+            arf_set(arb_midref(acb_realref(pmid + len + i)), arb_midref(acb_realref(deriv + i)));
+            arf_set(arb_midref(acb_imagref(pmid + len + i)), arb_midref(acb_imagref(deriv + i)));
+        }
+
+        tree = _acb_poly_tree_alloc(deg);
+        _acb_poly_tree_build(tree, xs, deg, wp);
+        _acb_poly_evaluate_vec_fast_precomp(vals, pmid, len, tree, deg, wp);
+        _acb_poly_evaluate_vec_fast_precomp(dvals, pmid + len, deg, tree, deg, wp);
+        _acb_poly_tree_free(tree, deg);
+
+        _acb_vec_clear(xs, deg);
+        _acb_vec_clear(pmid, len + deg);
+    }
+
+    num_threads = flint_get_num_threads();
+
+    if (num_threads > 1 && deg >= THREADED_CUTOFF)
+    {
+        pthread_t * threads;
+        aberth_arg_t * args;
+
+        num_threads = FLINT_MIN(num_threads, deg);
+        threads = flint_malloc(sizeof(pthread_t) * num_threads);
+        args = flint_malloc(sizeof(aberth_arg_t) * num_threads);
+
+        for (i = 0; i < num_threads; i++)
+        {
+            args[i].corr = corr;
+            args[i].roots = roots;
+            args[i].poly = poly;
+            args[i].deriv = deriv;
+            args[i].vals = vals;
+            args[i].dvals = dvals;
+            args[i].len = len;
+            args[i].i0 = (deg * i) / num_threads;
+            args[i].i1 = (deg * (i + 1)) / num_threads;
+            args[i].prec = prec;
+            pthread_create(&threads[i], NULL, _acb_poly_aberth_thread, &args[i]);
+        }
+
+        for (i = 0; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        flint_free(threads);
+        flint_free(args);
+    }
+    else
+    {
+        _acb_poly_aberth_corrections(corr, roots, poly, deriv,
+            vals, dvals, len, 0, deg, prec);
+    }
+
+    /* all corrections are computed from the old roots (Jacobi-style
+       iteration), so they can be applied independently */
+    for (i = 0; i < deg; i++)
+    {
+        acb_sub_mid(roots + i, roots + i, corr + i, prec);
+
+        arf_get_mag(arb_radref(acb_realref(roots + i)), arb_midref(acb_realref(corr + i)));
+        arf_get_mag(arb_radref(acb_imagref(roots + i)), arb_midref(acb_imagref(corr + i)));
+    }
+
+    _acb_vec_clear(corr, deg);
+
+    if (vals != NULL)
+    {
+        _acb_vec_clear(vals, deg);
+        _acb_vec_clear(dvals, deg);
+    }
+}
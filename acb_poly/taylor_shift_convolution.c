@@ -0,0 +1,98 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+
+#include "acb_poly.h"
+
+void
+_acb_poly_taylor_shift_convolution(acb_ptr poly, const acb_t c, slong n, slong prec)
+{
+    acb_ptr t, u;
+    acb_t w;
+    arb_t f;
+    slong i, d;
+
+    if (n <= 1 || acb_is_zero(c))
+        return;
+
+    d = n - 1;
+
+    t = _acb_vec_init(n);
+    u = _acb_vec_init(n);
+    acb_init(w);
+    arb_init(f);
+
+    /* u_i = i! a_i, reversed */
+    arb_one(f);
+    for (i = 0; i <= d; i++)
+    {
+        if (i > 1)
+            arb_mul_ui(f, f, i, prec);
+        acb_mul_arb(u + d - i, poly + i, f, prec);
+    }
+
+    /* t_j = d! / j! c^j; all these are integers times powers of c */
+    acb_one(t + d);
+    for (i = d; i > 0; i--)
+        acb_mul_ui(t + i - 1, t + i, i, prec);
+
+    if (!acb_is_one(c))
+    {
+        acb_set(w, c);
+        for (i = 1; i <= d; i++)
+        {
+            acb_mul(t + i, t + i, w, prec);
+            if (i < d)
+                acb_mul(w, w, c, prec);
+        }
+    }
+
+    /* u_{d-k} = d! k! b_k */
+    _acb_poly_mullow(poly, u, n, t, n, n, prec);
+    _acb_poly_reverse(u, poly, n, n);
+
+    arb_set(f, acb_realref(t + 0));
+    for (i = 0; i <= d; i++)
+    {
+        if (i > 1)
+            arb_mul_ui(f, f, i, prec);
+        acb_div_arb(poly + i, u + i, f, prec);
+    }
+
+    _acb_vec_clear(t, n);
+    _acb_vec_clear(u, n);
+    acb_clear(w);
+    arb_clear(f);
+}
+
+void
+acb_poly_taylor_shift_convolution(acb_poly_t g, const acb_poly_t f,
+    const acb_t c, slong prec)
+{
+    if (f != g)
+        acb_poly_set(g, f);
+
+    _acb_poly_taylor_shift_convolution(g->coeffs, c, g->length, prec);
+}
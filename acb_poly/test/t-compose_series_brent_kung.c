@@ -49,6 +49,12 @@ int main()
         rbits3 = 2 + n_randint(state, 200);
         n = 2 + n_randint(state, 25);
 
+        if (iter % 50 == 0)
+        {
+            flint_set_num_threads(1 + n_randint(state, 4));
+            n = 2 + n_randint(state, 150);
+        }
+
         fmpq_poly_init(A);
         fmpq_poly_init(B);
         fmpq_poly_init(C);
@@ -109,6 +115,7 @@ int main()
         acb_poly_clear(d);
     }
 
+    flint_set_num_threads(1);
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
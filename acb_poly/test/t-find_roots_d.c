@@ -0,0 +1,203 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+
+#include "acb_poly.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("find_roots_d....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000; iter++)
+    {
+        acb_poly_t A;
+        acb_ptr exact, approx;
+        acb_t t;
+        mag_t d, dmin, tol;
+        slong i, j, deg;
+
+        acb_init(t);
+        mag_init(d);
+        mag_init(dmin);
+        mag_init(tol);
+        acb_poly_init(A);
+
+        deg = 1 + n_randint(state, 8);
+
+        exact = _acb_vec_init(deg);
+        approx = _acb_vec_init(deg);
+
+        /* distinct roots on a small grid */
+        for (i = 0; i < deg; i++)
+        {
+            do {
+                acb_set_si_si(exact + i, (slong) n_randint(state, 11) - 5,
+                                         (slong) n_randint(state, 11) - 5);
+                for (j = 0; j < i; j++)
+                    if (acb_equal(exact + i, exact + j))
+                        break;
+            } while (j < i);
+        }
+
+        acb_poly_product_roots(A, exact, deg, 200);
+
+        if (n_randint(state, 2))
+        {
+            acb_randtest(t, state, 200, 10);
+            if (!acb_contains_zero(t))
+                _acb_vec_scalar_mul(A->coeffs, A->coeffs, A->length, t, 200);
+        }
+
+        mag_set_d(tol, 1e-6);
+
+        if (_acb_poly_find_roots_d(approx, A->coeffs, A->length, 100) < 0)
+        {
+            flint_printf("FAIL: no approximation\n");
+            acb_poly_printd(A, 15); flint_printf("\n\n");
+            abort();
+        }
+
+        for (i = 0; i < deg; i++)
+        {
+            mag_inf(dmin);
+
+            for (j = 0; j < deg; j++)
+            {
+                acb_sub(t, exact + i, approx + j, 53);
+                acb_get_mag(d, t);
+                mag_min(dmin, dmin, d);
+            }
+
+            if (mag_cmp(dmin, tol) > 0)
+            {
+                flint_printf("FAIL: root not approximated\n");
+                acb_poly_printd(A, 15); flint_printf("\n\n");
+                acb_printd(exact + i, 15); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _acb_vec_clear(exact, deg);
+        _acb_vec_clear(approx, deg);
+
+        acb_clear(t);
+        mag_clear(d);
+        mag_clear(dmin);
+        mag_clear(tol);
+        acb_poly_clear(A);
+    }
+
+    /* larger degrees: random Gaussian integer coefficients give
+       well-conditioned roots, which are isolated rigorously for
+       comparison */
+    for (iter = 0; iter < 100; iter++)
+    {
+        acb_poly_t A;
+        acb_ptr exact, approx;
+        acb_t t;
+        mag_t d, dmin, tol;
+        slong i, j, deg;
+
+        acb_init(t);
+        mag_init(d);
+        mag_init(dmin);
+        mag_init(tol);
+        acb_poly_init(A);
+
+        deg = 9 + n_randint(state, 120);
+
+        for (i = 0; i <= deg; i++)
+        {
+            acb_set_si_si(t, (slong) n_randint(state, 201) - 100,
+                             (slong) n_randint(state, 201) - 100);
+            acb_poly_set_coeff_acb(A, i, t);
+        }
+
+        if (acb_is_zero(A->coeffs + deg))
+        {
+            acb_one(t);
+            acb_poly_set_coeff_acb(A, deg, t);
+        }
+
+        exact = _acb_vec_init(deg);
+        approx = _acb_vec_init(deg);
+
+        if (_acb_poly_find_roots_d(approx, A->coeffs, A->length, 200) < 0)
+        {
+            flint_printf("FAIL: no approximation (deg = %wd)\n", deg);
+            acb_poly_printd(A, 15); flint_printf("\n\n");
+            abort();
+        }
+
+        /* only compare when the reference roots are all isolated */
+        if (acb_poly_find_roots(exact, A, NULL, 0, 128) == deg)
+        {
+            for (i = 0; i < deg; i++)
+            {
+                acb_get_mag(tol, exact + i);
+                mag_one(d);
+                mag_max(tol, tol, d);
+                mag_mul_2exp_si(tol, tol, -20);
+
+                mag_inf(dmin);
+
+                for (j = 0; j < deg; j++)
+                {
+                    acb_sub(t, exact + i, approx + j, 53);
+                    acb_get_mag(d, t);
+                    mag_min(dmin, dmin, d);
+                }
+
+                if (mag_cmp(dmin, tol) > 0)
+                {
+                    flint_printf("FAIL: root not approximated (deg = %wd)\n", deg);
+                    acb_poly_printd(A, 15); flint_printf("\n\n");
+                    acb_printd(exact + i, 15); flint_printf("\n\n");
+                    abort();
+                }
+            }
+        }
+
+        _acb_vec_clear(exact, deg);
+        _acb_vec_clear(approx, deg);
+
+        acb_clear(t);
+        mag_clear(d);
+        mag_clear(dmin);
+        mag_clear(tol);
+        acb_poly_clear(A);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,186 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+
+#include "acb_poly.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("refine_roots_aberth....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 300; iter++)
+    {
+        acb_poly_t A;
+        acb_ptr roots, deriv;
+        acb_t t;
+        slong i, deg, isolated, steps;
+        slong prec = 53 + n_randint(state, 200);
+
+        acb_init(t);
+        acb_poly_init(A);
+
+        /* occasionally exercise fast multipoint evaluation */
+        if (n_randint(state, 50) == 0)
+            deg = 128 + n_randint(state, 32);
+        else
+            deg = 1 + n_randint(state, 40);
+
+        do {
+            acb_poly_randtest(A, state, deg + 1, prec, 5);
+        } while (A->length < 2 || acb_contains_zero(A->coeffs + A->length - 1));
+
+        deg = A->length - 1;
+
+        roots = _acb_vec_init(deg);
+        deriv = _acb_vec_init(deg);
+
+        _acb_poly_derivative(deriv, A->coeffs, A->length, prec);
+
+        acb_set_d_d(roots + 0, 0.4, 0.9);
+        for (i = 1; i < deg; i++)
+            acb_mul(roots + i, roots + i - 1, roots + 0, prec);
+        for (i = 0; i < deg; i++)
+        {
+            mag_zero(arb_radref(acb_realref(roots + i)));
+            mag_zero(arb_radref(acb_imagref(roots + i)));
+        }
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        steps = 2 * deg + n_sqrt(prec);
+        for (i = 0; i < steps; i++)
+            _acb_poly_refine_roots_aberth(roots, A->coeffs, deriv, A->length, prec);
+
+        flint_set_num_threads(1);
+
+        isolated = _acb_poly_validate_roots(roots, A->coeffs, A->length, prec);
+
+        for (i = 0; i < isolated; i++)
+        {
+            acb_poly_evaluate(t, A, roots + i, prec);
+            if (!acb_contains_zero(t))
+            {
+                flint_printf("FAIL: poly(root) does not contain zero\n");
+                acb_poly_printd(A, 15); flint_printf("\n\n");
+                acb_printd(roots + i, 15); flint_printf("\n\n");
+                acb_printd(t, 15); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _acb_vec_clear(roots, deg);
+        _acb_vec_clear(deriv, deg);
+
+        acb_clear(t);
+        acb_poly_clear(A);
+    }
+
+    /* well-separated roots close to the unit circle, starting from
+       perturbed roots: every root must be isolated after refinement */
+    for (iter = 0; iter < 100; iter++)
+    {
+        acb_poly_t A;
+        acb_ptr exact, roots, deriv;
+        acb_t t;
+        slong i, deg, isolated, steps;
+        slong prec = 53 + n_randint(state, 200);
+
+        acb_init(t);
+        acb_poly_init(A);
+
+        if (n_randint(state, 4) == 0)
+            deg = 128 + n_randint(state, 32);
+        else
+            deg = 1 + n_randint(state, 40);
+
+        exact = _acb_vec_init(deg);
+        roots = _acb_vec_init(deg);
+        deriv = _acb_vec_init(deg);
+
+        /* exp(pi i (2k + d) / deg) (1 + r) with 0 <= d < 1/2, |r| < 1/16 */
+        for (i = 0; i < deg; i++)
+        {
+            acb_set_ui(t, 2 * i * 256 + n_randint(state, 128));
+            acb_div_ui(t, t, 256 * deg, prec + 64);
+            acb_exp_pi_i(exact + i, t, prec + 64);
+            arb_set_si(acb_realref(t), (slong) n_randint(state, 64) - 32);
+            arb_mul_2exp_si(acb_realref(t), acb_realref(t), -9);
+            arb_add_ui(acb_realref(t), acb_realref(t), 1, prec + 64);
+            acb_mul_arb(exact + i, exact + i, acb_realref(t), prec + 64);
+        }
+
+        acb_poly_product_roots(A, exact, deg, prec + 64);
+        _acb_poly_derivative(deriv, A->coeffs, A->length, prec);
+
+        for (i = 0; i < deg; i++)
+        {
+            arb_set_si(acb_realref(t), (slong) n_randint(state, 64) - 32);
+            arb_set_si(acb_imagref(t), (slong) n_randint(state, 64) - 32);
+            acb_mul_2exp_si(t, t, -14);
+            acb_add(roots + i, exact + i, t, prec);
+            mag_zero(arb_radref(acb_realref(roots + i)));
+            mag_zero(arb_radref(acb_imagref(roots + i)));
+        }
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        steps = 10 + FLINT_BIT_COUNT(prec);
+        for (i = 0; i < steps; i++)
+            _acb_poly_refine_roots_aberth(roots, A->coeffs, deriv, A->length, prec);
+
+        flint_set_num_threads(1);
+
+        isolated = _acb_poly_validate_roots(roots, A->coeffs, A->length, prec);
+
+        if (isolated != deg)
+        {
+            flint_printf("FAIL: isolated = %wd, deg = %wd, prec = %wd\n\n",
+                isolated, deg, prec);
+            for (i = 0; i < deg; i++)
+            {
+                acb_printd(roots + i, 15); flint_printf("\n");
+            }
+            abort();
+        }
+
+        _acb_vec_clear(exact, deg);
+        _acb_vec_clear(roots, deg);
+        _acb_vec_clear(deriv, deg);
+
+        acb_clear(t);
+        acb_poly_clear(A);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,117 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+
+#include "acb_poly.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("taylor_shift....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000; iter++)
+    {
+        acb_poly_t a, b, c, d, e, f;
+        acb_t x;
+        slong prec1, prec2;
+
+        prec1 = 2 + n_randint(state, 200);
+        prec2 = 2 + n_randint(state, 200);
+
+        acb_poly_init(a);
+        acb_poly_init(b);
+        acb_poly_init(c);
+        acb_poly_init(d);
+        acb_poly_init(e);
+        acb_poly_init(f);
+        acb_init(x);
+
+        acb_poly_randtest(a, state, 1 + n_randint(state, 80), prec1, 10);
+
+        switch (n_randint(state, 4))
+        {
+            case 0:
+                acb_one(x);
+                break;
+            case 1:
+                acb_set_si(x, -1);
+                break;
+            default:
+                acb_randtest(x, state, prec1, 5);
+                mag_zero(arb_radref(acb_realref(x)));
+                mag_zero(arb_radref(acb_imagref(x)));
+        }
+
+        acb_poly_taylor_shift_horner(b, a, x, prec2);
+        acb_poly_taylor_shift_divconquer(c, a, x, prec2);
+        acb_poly_taylor_shift_convolution(d, a, x, prec2);
+        acb_poly_taylor_shift(e, a, x, prec2);
+
+        if (!acb_poly_overlaps(b, c) || !acb_poly_overlaps(b, d)
+            || !acb_poly_overlaps(b, e))
+        {
+            flint_printf("FAIL\n\n");
+            flint_printf("a = "); acb_poly_printd(a, 15); flint_printf("\n\n");
+            flint_printf("x = "); acb_printd(x, 15); flint_printf("\n\n");
+            flint_printf("b = "); acb_poly_printd(b, 15); flint_printf("\n\n");
+            flint_printf("c = "); acb_poly_printd(c, 15); flint_printf("\n\n");
+            flint_printf("d = "); acb_poly_printd(d, 15); flint_printf("\n\n");
+            flint_printf("e = "); acb_poly_printd(e, 15); flint_printf("\n\n");
+            abort();
+        }
+
+        /* check that shifting back by -c gives f(x) */
+        acb_poly_set(f, e);
+        acb_neg(x, x);
+        acb_poly_taylor_shift(f, f, x, prec2);
+
+        if (!acb_poly_contains(f, a))
+        {
+            flint_printf("FAIL (inverse)\n\n");
+            flint_printf("a = "); acb_poly_printd(a, 15); flint_printf("\n\n");
+            flint_printf("x = "); acb_printd(x, 15); flint_printf("\n\n");
+            flint_printf("f = "); acb_poly_printd(f, 15); flint_printf("\n\n");
+            abort();
+        }
+
+        acb_poly_clear(a);
+        acb_poly_clear(b);
+        acb_poly_clear(c);
+        acb_poly_clear(d);
+        acb_poly_clear(e);
+        acb_poly_clear(f);
+        acb_clear(x);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -41,8 +41,10 @@ int main()
         acb_ptr z1, z2, Nasx;
         slong i, M, len, prec;
 
+        flint_set_num_threads(1 + n_randint(state, 4));
+
         prec = 2 + n_randint(state, 400);
-        len = 1 + n_randint(state, 30);
+        len = 1 + n_randint(state, n_randint(state, 4) ? 30 : 100);
         M = n_randint(state, 40);
 
         acb_init(Na);
@@ -43,11 +43,13 @@ void _acb_poly_mullow_cpx(acb_ptr res, acb_srcptr src, slong len, const acb_t c,
 }
 
 
+/* everything except the power sum: the integral term, (N+a)^(-(s+x)) / 2
+   and the Euler-Maclaurin tail */
 void
-_acb_poly_zeta_em_sum(acb_ptr z, const acb_t s, const acb_t a, int deflate, ulong N, ulong M, slong d, slong prec)
+_acb_poly_zeta_em_sum_remainder(acb_ptr z, const acb_t s, const acb_t a, int deflate, ulong N, ulong M, slong d, slong prec)
 {
     acb_ptr t, u, v, term, sum;
-    acb_t Na, one;
+    acb_t Na;
     slong i;
 
     t = _acb_vec_init(d + 1);
@@ -56,18 +58,6 @@ _acb_poly_zeta_em_sum(acb_ptr z, const acb_t s, const acb_t a, int deflate, ulon
     term = _acb_vec_init(d);
     sum = _acb_vec_init(d);
     acb_init(Na);
-    acb_init(one);
-
-    prec += 2 * (FLINT_BIT_COUNT(N) + FLINT_BIT_COUNT(d));
-    acb_one(one);
-
-    /* sum 1/(k+a)^(s+x) */
-    if (acb_is_one(a) && d <= 3)
-        _acb_poly_powsum_one_series_sieved(sum, s, N, d, prec);
-    else if (N > 50 && flint_get_num_threads() > 1)
-        _acb_poly_powsum_series_naive_threaded(sum, s, a, one, N, d, prec);
-    else
-        _acb_poly_powsum_series_naive(sum, s, a, one, N, d, prec);
 
     /* t = 1/(N+a)^(s+x); we might need one extra term for deflation */
     acb_add_ui(Na, a, N, prec);
@@ -142,6 +132,36 @@ _acb_poly_zeta_em_sum(acb_ptr z, const acb_t s, const acb_t a, int deflate, ulon
     _acb_vec_clear(term, d);
     _acb_vec_clear(sum, d);
     acb_clear(Na);
+}
+
+void
+_acb_poly_zeta_em_sum(acb_ptr z, const acb_t s, const acb_t a, int deflate, ulong N, ulong M, slong d, slong prec)
+{
+    acb_ptr u, sum;
+    acb_t one;
+
+    u = _acb_vec_init(d);
+    sum = _acb_vec_init(d);
+    acb_init(one);
+
+    prec += 2 * (FLINT_BIT_COUNT(N) + FLINT_BIT_COUNT(d));
+    acb_one(one);
+
+    /* sum 1/(k+a)^(s+x) */
+    if (acb_is_one(a) && d <= 3 && N > 200 && flint_get_num_threads() > 1)
+        _acb_poly_powsum_one_series_sieved_threaded(sum, s, N, d, prec);
+    else if (acb_is_one(a) && d <= 3)
+        _acb_poly_powsum_one_series_sieved(sum, s, N, d, prec);
+    else if (N > 50 && flint_get_num_threads() > 1)
+        _acb_poly_powsum_series_naive_threaded(sum, s, a, one, N, d, prec);
+    else
+        _acb_poly_powsum_series_naive(sum, s, a, one, N, d, prec);
+
+    _acb_poly_zeta_em_sum_remainder(u, s, a, deflate, N, M, d, prec);
+    _acb_vec_add(z, sum, u, d, prec);
+
+    _acb_vec_clear(u, d);
+    _acb_vec_clear(sum, d);
     acb_clear(one);
 }
 
@@ -23,12 +23,71 @@
 
 ******************************************************************************/
 
+#include <pthread.h>
 #include "acb_poly.h"
 #include "bernoulli.h"
 
+/* split a node over threads when plen^2 * prec exceeds this */
+#define THREADED_CUTOFF 200000
+
+static void bsplit(acb_ptr P, acb_ptr T, const fmpq * B, const acb_t s,
+    const acb_t Na, slong a, slong b, int cont, slong len, slong prec, slong num_threads);
+
+typedef struct
+{
+    acb_ptr P;
+    acb_ptr T;
+    const fmpq * B;
+    acb_srcptr s;
+    acb_srcptr Na;
+    slong a;
+    slong b;
+    int cont;
+    slong len;
+    slong prec;
+    slong num_threads;
+}
+bsplit_arg_t;
+
+static void *
+bsplit_worker(void * arg_ptr)
+{
+    bsplit_arg_t arg = *((bsplit_arg_t *) arg_ptr);
+
+    bsplit(arg.P, arg.T, arg.B, arg.s, arg.Na, arg.a, arg.b, arg.cont,
+        arg.len, arg.prec, arg.num_threads);
+
+    flint_cleanup();
+    return NULL;
+}
+
+typedef struct
+{
+    acb_ptr res;
+    acb_srcptr poly1;
+    slong len1;
+    acb_srcptr poly2;
+    slong len2;
+    slong n;
+    slong prec;
+}
+mullow_arg_t;
+
+static void *
+mullow_worker(void * arg_ptr)
+{
+    mullow_arg_t arg = *((mullow_arg_t *) arg_ptr);
+
+    _acb_poly_mullow(arg.res, arg.poly1, arg.len1, arg.poly2, arg.len2,
+        arg.n, arg.prec);
+
+    flint_cleanup();
+    return NULL;
+}
+
 static void
-bsplit(acb_ptr P, acb_ptr T, const acb_t s, const acb_t Na,
-    slong a, slong b, int cont, slong len, slong prec)
+bsplit(acb_ptr P, acb_ptr T, const fmpq * B, const acb_t s,
+    const acb_t Na, slong a, slong b, int cont, slong len, slong prec, slong num_threads)
 {
     slong plen = FLINT_MIN(2 * (b - a) + 1, len);
 
@@ -82,8 +141,8 @@ bsplit(acb_ptr P, acb_ptr T, const acb_t s, const acb_t Na,
         _acb_vec_scalar_div(P, P, plen, T, prec);
 
         /* T = P * B_{2j+2} */
-        _acb_vec_scalar_mul_fmpz(T, P, plen, fmpq_numref(bernoulli_cache + 2 * j + 2), prec);
-        _acb_vec_scalar_div_fmpz(T, T, plen, fmpq_denref(bernoulli_cache + 2 * j + 2), prec);
+        _acb_vec_scalar_mul_fmpz(T, P, plen, fmpq_numref(B + 2 * j + 2), prec);
+        _acb_vec_scalar_div_fmpz(T, T, plen, fmpq_denref(B + 2 * j + 2), prec);
 
         fmpz_clear(t);
     }
@@ -104,15 +163,63 @@ bsplit(acb_ptr P, acb_ptr T, const acb_t s, const acb_t Na,
         P2 = T1 + len1;
         T2 = P2 + len2;
 
-        bsplit(P1, T1, s, Na, a, m, 1, len, prec);
-        bsplit(P2, T2, s, Na, m, b, 1, len, prec);
+        if (num_threads > 1 && plen * plen * prec > THREADED_CUTOFF)
+        {
+            pthread_t thread;
+            bsplit_arg_t arg;
+            mullow_arg_t marg;
+
+            arg.P = P2;
+            arg.T = T2;
+            arg.B = B;
+            arg.s = s;
+            arg.Na = Na;
+            arg.a = m;
+            arg.b = b;
+            arg.cont = 1;
+            arg.len = len;
+            arg.prec = prec;
+            arg.num_threads = num_threads / 2;
+
+            pthread_create(&thread, NULL, bsplit_worker, &arg);
+            bsplit(P1, T1, B, s, Na, a, m, 1, len, prec,
+                num_threads - num_threads / 2);
+            pthread_join(thread, NULL);
+
+            /* the two products are independent */
+            if (cont)
+            {
+                marg.res = P;
+                marg.poly1 = P2;
+                marg.len1 = len2;
+                marg.poly2 = P1;
+                marg.len2 = len1;
+                marg.n = plen;
+                marg.prec = prec;
+
+                pthread_create(&thread, NULL, mullow_worker, &marg);
+                _acb_poly_mullow(T, T2, len2, P1, len1, plen, prec);
+                pthread_join(thread, NULL);
+            }
+            else
+            {
+                _acb_poly_mullow(T, T2, len2, P1, len1, plen, prec);
+            }
+        }
+        else
+        {
+            bsplit(P1, T1, B, s, Na, a, m, 1, len, prec, 1);
+            bsplit(P2, T2, B, s, Na, m, b, 1, len, prec, 1);
+
+            /* P = P1 * P2 */
+            if (cont)
+                _acb_poly_mullow(P, P2, len2, P1, len1, plen, prec);
 
-        /* P = P1 * P2 */
-        if (cont)
-            _acb_poly_mullow(P, P2, len2, P1, len1, plen, prec);
+            /* T = P1 * T2 */
+            _acb_poly_mullow(T, T2, len2, P1, len1, plen, prec);
+        }
 
         /* T = T1 + P1 * T2 */
-        _acb_poly_mullow(T, T2, len2, P1, len1, plen, prec);
         _acb_vec_add(T, T, T1, len1, prec);
 
         _acb_vec_clear(P1, alloc);
@@ -135,7 +242,9 @@ _acb_poly_zeta_em_tail_bsplit(acb_ptr z, const acb_t s, const acb_t Na, acb_srcp
     P = _acb_vec_init(len);
     T = _acb_vec_init(len);
 
-    bsplit(P, T, s, Na, 0, M, 0, len, prec);
+    /* the Bernoulli cache is thread-local, so pass it to the workers */
+    bsplit(P, T, bernoulli_cache, s, Na, 0, M, 0, len, prec,
+        flint_get_num_threads());
 
     _acb_poly_mullow(z, T, len, Nasx, len, len, prec);
 
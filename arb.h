@@ -32,6 +32,7 @@
 #define ARB_INLINE static __inline__
 #endif
 
+#include <float.h>
 #include "fmprb.h"
 #include "mag.h"
 #include "arf.h"
@@ -585,9 +586,15 @@ void arb_log1p(arb_t r, const arb_t z, slong prec);
 void arb_exp(arb_t z, const arb_t x, slong prec);
 void arb_expm1(arb_t z, const arb_t x, slong prec);
 void arb_exp_invexp(arb_t z, arb_t w, const arb_t x, slong prec);
+void arb_exp_arith_progression(arb_ptr res, const arb_t a, const arb_t d,
+    slong n, slong prec);
 void arb_sin(arb_t s, const arb_t x, slong prec);
 void arb_cos(arb_t c, const arb_t x, slong prec);
 void arb_sin_cos(arb_t s, arb_t c, const arb_t x, slong prec);
+void _arb_vec_exp(arb_ptr res, arb_srcptr x, slong len, slong prec);
+void _arb_vec_log(arb_ptr res, arb_srcptr x, slong len, slong prec);
+void _arb_vec_sin_cos(arb_ptr s, arb_ptr c, arb_srcptr x, slong len, slong prec);
+void _arb_vec_lgamma(arb_ptr res, arb_srcptr x, slong len, slong prec);
 void arb_sin_pi(arb_t s, const arb_t x, slong prec);
 void arb_cos_pi(arb_t c, const arb_t x, slong prec);
 void arb_sin_cos_pi(arb_t s, arb_t c, const arb_t x, slong prec);
@@ -601,6 +608,12 @@ void _arb_sin_cos_pi_fmpq_algebraic(arb_t s, arb_t c, ulong p, ulong q, slong pr
 void arb_sin_cos_pi_fmpq(arb_t s, arb_t c, const fmpq_t x, slong prec);
 void arb_sin_pi_fmpq(arb_t s, const fmpq_t x, slong prec);
 void arb_cos_pi_fmpq(arb_t c, const fmpq_t x, slong prec);
+
+#define ARB_SIN_COS_PI_CACHE_NUM 8
+#define ARB_SIN_COS_PI_CACHE_MAX_Q 256
+
+int _arb_sin_cos_pi_fmpq_cached(arb_t s, arb_t c, ulong p, ulong q, slong prec);
+
 void arb_sinh(arb_t z, const arb_t x, slong prec);
 void arb_cosh(arb_t z, const arb_t x, slong prec);
 void arb_sinh_cosh(arb_t s, arb_t c, const arb_t x, slong prec);
@@ -636,12 +649,33 @@ void arb_rgamma(arb_t z, const arb_t x, slong prec);
 void arb_gamma(arb_t z, const arb_t x, slong prec);
 void arb_gamma_fmpq(arb_t z, const fmpq_t x, slong prec);
 void arb_gamma_fmpz(arb_t z, const fmpz_t x, slong prec);
+
+#define ARB_GAMMA_FMPQ_CACHE_NUM 8
+#define ARB_GAMMA_FMPQ_CACHE_MAX_Q 128
+
+int _arb_gamma_fmpq_cached(arb_t y, ulong p, ulong q, slong prec);
+
+arb_srcptr _arb_gamma_stirling_coeffs_cached(slong n, int digamma, slong prec);
+
 void arb_digamma(arb_t y, const arb_t x, slong prec);
 void arb_zeta(arb_t z, const arb_t s, slong prec);
 void arb_zeta_ui(arb_t z, ulong n, slong prec);
 void arb_hurwitz_zeta(arb_t z, const arb_t s, const arb_t a, slong prec);
 void arb_bernoulli_ui(arb_t z, ulong n, slong prec);
 
+/* evaluation to a target accuracy */
+
+typedef void (*arb_eval_func_t)(arb_t res, const arb_t x,
+    void * param, slong prec);
+
+#define ARB_ACCURATE_MAX_PREC(target) (8 * (target) + 1024)
+
+int arb_eval_accurate(arb_t res, arb_eval_func_t func, void * param,
+    const arb_t x, slong target_rel_bits, slong max_prec);
+
+int arb_gamma_accurate(arb_t res, const arb_t x, slong target_rel_bits);
+int arb_zeta_accurate(arb_t res, const arb_t x, slong target_rel_bits);
+
 void arb_rising_ui_bs(arb_t y, const arb_t x, ulong n, slong prec);
 void arb_rising_ui_rs(arb_t y, const arb_t x, ulong n, ulong m, slong prec);
 void arb_rising_ui_rec(arb_t y, const arb_t x, ulong n, slong prec);
@@ -655,11 +689,17 @@ void arb_rising2_ui(arb_t u, arb_t v, const arb_t x, ulong n, slong prec);
 
 void arb_log_ui_from_prev(arb_t s, ulong k, arb_t log_prev, ulong prev, slong prec);
 
+/* maximum total number of bits stored in the cache of prime logarithms */
+#define ARB_LOG_UI_VEC_CACHE_BITS (WORD(1) << 25)
+
+void arb_log_ui_vec(arb_ptr res, slong n, slong prec);
+
 void arb_const_apery(arb_t s, slong prec);
 
 void arb_zeta_ui_asymp(arb_t x, ulong s, slong prec);
 void arb_zeta_ui_borwein_bsplit(arb_t x, ulong s, slong prec);
 void arb_zeta_ui_euler_product(arb_t z, ulong s, slong prec);
+void arb_zeta_ui_vec_euler_product(arb_ptr z, ulong start, slong num, ulong step, slong prec);
 void arb_zeta_ui_bernoulli(arb_t x, ulong n, slong prec);
 void arb_zeta_ui_vec_borwein(arb_ptr z, ulong start, slong num, ulong step, slong prec);
 void arb_zeta_ui(arb_t x, ulong n, slong prec);
@@ -979,6 +1019,16 @@ _arb_atan_taylor_naive(mp_ptr y, mp_limb_t * error,
 void _arb_atan_taylor_rs(mp_ptr y, mp_limb_t * error,
     mp_srcptr x, mp_size_t xn, ulong N, int alternating);
 
+void _arb_atan_taylor_rs_vec(mp_ptr y, mp_limb_t * error,
+    mp_srcptr x, slong num, mp_size_t xn, ulong N, int alternating);
+
+/* lazily computed tables atan(p/2^8), atan(p/2^16) above ARB_ATAN_TAB2_PREC */
+#define ARB_ATAN_DYN_TAB_BITS 8
+#define ARB_ATAN_DYN_TAB_NUM (1 << ARB_ATAN_DYN_TAB_BITS)
+#define ARB_ATAN_DYN_TAB_MAX_PREC 262144
+
+void _arb_atan_dyn_tab(arb_t res, int level, ulong p, slong prec);
+
 /* logarithm implementation */
 
 #define ARB_LOG_TAB11_BITS 7
@@ -1023,6 +1073,9 @@ void _arb_exp_taylor_naive(mp_ptr y, mp_limb_t * error,
 void _arb_exp_taylor_rs(mp_ptr y, mp_limb_t * error,
     mp_srcptr x, mp_size_t xn, ulong N);
 
+void _arb_exp_taylor_rs_vec(mp_ptr y, mp_limb_t * error,
+    mp_srcptr x, slong num, mp_size_t xn, ulong N);
+
 void arb_exp_arf_bb(arb_t z, const arf_t x, slong prec, int minus_one);
 
 int _arb_get_mpn_fixed_mod_log2(mp_ptr w, fmpz_t q, mp_limb_t * error,
@@ -1036,6 +1089,13 @@ void _arb_exp_sum_bs_powtab(fmpz_t T, fmpz_t Q, mp_bitcnt_t * Qexp,
 void _arb_exp_sum_bs_simple(fmpz_t T, fmpz_t Q, mp_bitcnt_t * Qexp,
     const fmpz_t x, mp_bitcnt_t r, slong N);
 
+/* lazily computed tables exp(p/2^8), exp(p/2^16) above ARB_EXP_TAB2_PREC */
+#define ARB_EXP_DYN_TAB_BITS 8
+#define ARB_EXP_DYN_TAB_NUM (1 << ARB_EXP_DYN_TAB_BITS)
+#define ARB_EXP_DYN_TAB_MAX_PREC 262144
+
+void _arb_exp_dyn_tab(arb_t res, int level, ulong p, slong prec);
+
 /* sin/cos implementation */
 
 /* only goes up to (pi/4) * 256 */
@@ -1066,6 +1126,10 @@ void _arb_sin_cos_taylor_rs(mp_ptr ysin, mp_ptr ycos,
     mp_limb_t * error, mp_srcptr x, mp_size_t xn, ulong N,
     int sinonly, int alternating);
 
+void _arb_sin_cos_taylor_rs_vec(mp_ptr ysin, mp_ptr ycos,
+    mp_limb_t * error, mp_srcptr x, slong num, mp_size_t xn, ulong N,
+    int sinonly, int alternating);
+
 int _arb_get_mpn_fixed_mod_pi4(mp_ptr w, fmpz_t q, int * octant,
     mp_limb_t * error, const arf_t x, mp_size_t wn);
 
@@ -1103,6 +1167,28 @@ void _arb_atan_sum_bs_powtab(fmpz_t T, fmpz_t Q, mp_bitcnt_t * Qexp,
 
 void arb_atan_arf_bb(arb_t z, const arf_t x, slong prec);
 
+/* double-precision implementations */
+
+/* the double kernels are only rigorous with strict IEEE double evaluation */
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+#define ARB_D_PREC 48
+#else
+#define ARB_D_PREC 0
+#endif
+
+#define ARB_D_ERR_BITS 50
+
+double _arb_exp_d(double x);
+void _arb_exp_d_vec(double * y, const double * x, slong len);
+double _arb_log_d(double x);
+void _arb_log_d_vec(double * y, const double * x, slong len);
+void _arb_sin_cos_d(double * s, double * c, double x);
+void _arb_sin_cos_d_vec(double * s, double * c, const double * x, slong len);
+double _arb_atan_d(double x);
+void _arb_atan_d_vec(double * y, const double * x, slong len);
+
+void _arb_set_d_fast(arb_t z, double v, int relative, slong prec);
+
 #ifdef __cplusplus
 }
 #endif
@@ -107,6 +107,87 @@ mag_add_ui_2exp_si(mag_t z, const mag_t x, ulong y, slong e)
     mag_clear(t);
 }
 
+/* atan(y) = atan(p1/2^8) + atan(p2/2^16) + atan(r), |r| < 2^-16,
+   using the lazily computed tables */
+static void
+arb_atan_arf_dyn_tab(arb_t z, const arf_t x, slong prec)
+{
+    slong wp, level;
+    ulong p;
+    int negative, inverse;
+    fmpz_t t;
+    arf_t a;
+    arb_t u, v, w;
+
+    negative = ARF_SGNBIT(x);
+    inverse = arf_cmpabs_2exp_si(x, 0) > 0;
+    wp = prec + 2 * ARB_ATAN_DYN_TAB_BITS + 4;
+
+    fmpz_init(t);
+    arf_init(a);
+    arb_init(u);
+    arb_init(v);
+    arb_init(w);
+
+    arb_set_arf(u, x);
+    arb_abs(u, u);
+    if (inverse)
+        arb_ui_div(u, 1, u, wp);
+
+    arb_zero(z);
+
+    /* u -> (u - a) / (1 + u a) with a = p/2^8, then a = p/2^16 */
+    for (level = 0; level < 2; level++)
+    {
+        if (arf_sgn(arb_midref(u)) > 0)
+        {
+            arf_get_fmpz_fixed_si(t, arb_midref(u),
+                -ARB_ATAN_DYN_TAB_BITS * (level + 1));
+            p = fmpz_get_ui(t);
+            p = FLINT_MIN(p, ARB_ATAN_DYN_TAB_NUM - 1);
+        }
+        else
+        {
+            p = 0;
+        }
+
+        if (p != 0)
+        {
+            arf_set_ui_2exp_si(a, p, -ARB_ATAN_DYN_TAB_BITS * (level + 1));
+            arb_mul_arf(v, u, a, wp);
+            arb_add_ui(v, v, 1, wp);
+            arb_sub_arf(u, u, a, wp);
+            arb_div(u, u, v, wp);
+
+            _arb_atan_dyn_tab(w, level, p, wp);
+            arb_add(z, z, w, wp);
+        }
+    }
+
+    /* |atan'| <= 1 */
+    arb_atan_arf_bb(w, arb_midref(u), wp);
+    mag_add(arb_radref(w), arb_radref(w), arb_radref(u));
+    arb_add(z, z, w, wp);
+
+    if (inverse)
+    {
+        arb_const_pi(w, wp);
+        arb_mul_2exp_si(w, w, -1);
+        arb_sub(z, w, z, wp);
+    }
+
+    if (negative)
+        arb_neg(z, z);
+
+    arb_set_round(z, z, prec);
+
+    fmpz_clear(t);
+    arf_clear(a);
+    arb_clear(u);
+    arb_clear(v);
+    arb_clear(w);
+}
+
 void
 arb_atan_arf(arb_t z, const arf_t x, slong prec)
 {
@@ -161,6 +242,18 @@ arb_atan_arf(arb_t z, const arf_t x, slong prec)
             return;
         }
 
+        /* low precision -- use hardware doubles */
+        if (prec <= ARB_D_PREC)
+        {
+            double v;
+
+            if (_arf_get_d_fast(&v, x))
+            {
+                _arb_set_d_fast(z, _arb_atan_d(v), 1, prec);
+                return;
+            }
+        }
+
         ARF_GET_MPN_READONLY(xp, xn, x);
 
         /* Special case: +/- 1 (we require |x| != 1 later on) */
@@ -179,7 +272,10 @@ arb_atan_arf(arb_t z, const arf_t x, slong prec)
         /* Too high precision to use table */
         if (wp > ARB_ATAN_TAB2_PREC)
         {
-            arb_atan_arf_bb(z, x, prec);
+            if (exp > -ARB_ATAN_DYN_TAB_BITS && prec <= ARB_ATAN_DYN_TAB_MAX_PREC)
+                arb_atan_arf_dyn_tab(z, x, prec);
+            else
+                arb_atan_arf_bb(z, x, prec);
             return;
         }
 
@@ -0,0 +1,128 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+
+/* atan(c) = ATAN_HI + ATAN_LO + eps with |eps| < 2^-108 */
+#define ATAN_05_HI 0.4636476090008061
+#define ATAN_05_LO 2.2698777452961687e-17
+#define ATAN_1_HI 0.7853981633974483
+#define ATAN_1_LO 3.061616997868383e-17
+#define ATAN_15_HI 0.982793723247329
+#define ATAN_15_LO 1.3903311031230998e-17
+#define ATAN_INF_HI 1.5707963267948966
+#define ATAN_INF_LO 6.123233995736766e-17
+
+/*
+    Writes atan(|x|) = atan(c) + atan(t) with c in {0, 1/2, 1, 3/2, inf}
+    and |t| <= 7/16. The reduced argument t has a relative error of at
+    most 3 u where u = 2^-53, which perturbs atan(t) by a relative error
+    of at most 3 u. The series for atan(t) is truncated after the t^45
+    term (relative error < 2^-60), and including the remaining rounding
+    errors and the final addition, the relative error of the result is
+    less than 6 u < 2^-50. Requires 2^-500 <= |x| <= 2^500.
+*/
+static __inline__ double
+_atan_d_kernel(double x)
+{
+    double a, t, z, p, hi, lo, r;
+
+    a = fabs(x);
+
+    if (a < 0.4375)
+    {
+        t = a;
+        hi = lo = 0.0;
+    }
+    else if (a < 0.6875)
+    {
+        t = (2.0 * a - 1.0) / (2.0 + a);
+        hi = ATAN_05_HI;
+        lo = ATAN_05_LO;
+    }
+    else if (a < 1.1875)
+    {
+        t = (a - 1.0) / (a + 1.0);
+        hi = ATAN_1_HI;
+        lo = ATAN_1_LO;
+    }
+    else if (a < 2.4375)
+    {
+        t = (a - 1.5) / (1.0 + 1.5 * a);
+        hi = ATAN_15_HI;
+        lo = ATAN_15_LO;
+    }
+    else
+    {
+        t = -1.0 / a;
+        hi = ATAN_INF_HI;
+        lo = ATAN_INF_LO;
+    }
+
+    z = t * t;
+
+    p = 1.0 / 45.0;
+    p = p * z - 1.0 / 43.0;
+    p = p * z + 1.0 / 41.0;
+    p = p * z - 1.0 / 39.0;
+    p = p * z + 1.0 / 37.0;
+    p = p * z - 1.0 / 35.0;
+    p = p * z + 1.0 / 33.0;
+    p = p * z - 1.0 / 31.0;
+    p = p * z + 1.0 / 29.0;
+    p = p * z - 1.0 / 27.0;
+    p = p * z + 1.0 / 25.0;
+    p = p * z - 1.0 / 23.0;
+    p = p * z + 1.0 / 21.0;
+    p = p * z - 1.0 / 19.0;
+    p = p * z + 1.0 / 17.0;
+    p = p * z - 1.0 / 15.0;
+    p = p * z + 1.0 / 13.0;
+    p = p * z - 1.0 / 11.0;
+    p = p * z + 1.0 / 9.0;
+    p = p * z - 1.0 / 7.0;
+    p = p * z + 1.0 / 5.0;
+    p = p * z - 1.0 / 3.0;
+
+    r = hi + (lo + (t + t * (z * p)));
+
+    return (x < 0) ? -r : r;
+}
+
+double
+_arb_atan_d(double x)
+{
+    return _atan_d_kernel(x);
+}
+
+void
+_arb_atan_d_vec(double * y, const double * x, slong len)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        y[i] = _atan_d_kernel(x[i]);
+}
+
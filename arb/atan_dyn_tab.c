@@ -0,0 +1,89 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+
+/*
+Entry level * ARB_ATAN_DYN_TAB_NUM + p holds atan(p / 2^(8 (level + 1)))
+computed to precision atan_dyn_tab_prec[...] (zero if not yet computed).
+Like the other caches, the table is thread-local and freed by
+flint_cleanup.
+*/
+TLS_PREFIX arb_ptr atan_dyn_tab = NULL;
+TLS_PREFIX slong * atan_dyn_tab_prec = NULL;
+
+static void
+atan_dyn_tab_cleanup(void)
+{
+    _arb_vec_clear(atan_dyn_tab, 2 * ARB_ATAN_DYN_TAB_NUM);
+    flint_free(atan_dyn_tab_prec);
+    atan_dyn_tab = NULL;
+    atan_dyn_tab_prec = NULL;
+}
+
+void
+_arb_atan_dyn_tab(arb_t res, int level, ulong p, slong prec)
+{
+    slong i, wp;
+
+    if (level < 0 || level > 1 || p >= ARB_ATAN_DYN_TAB_NUM)
+    {
+        flint_printf("_arb_atan_dyn_tab: index out of range\n");
+        abort();
+    }
+
+    if (p == 0)
+    {
+        arb_zero(res);
+        return;
+    }
+
+    if (atan_dyn_tab == NULL)
+    {
+        atan_dyn_tab = _arb_vec_init(2 * ARB_ATAN_DYN_TAB_NUM);
+        atan_dyn_tab_prec = flint_calloc(2 * ARB_ATAN_DYN_TAB_NUM, sizeof(slong));
+        flint_register_cleanup_function(atan_dyn_tab_cleanup);
+    }
+
+    i = level * ARB_ATAN_DYN_TAB_NUM + p;
+
+    if (atan_dyn_tab_prec[i] < prec)
+    {
+        arf_t t;
+
+        /* round the precision up, so that callers increasing the
+           precision gradually do not recompute the entry every time */
+        wp = FLINT_MAX(prec, atan_dyn_tab_prec[i] + atan_dyn_tab_prec[i] / 4);
+        wp = ((wp + 4095) / 4096) * 4096;
+
+        arf_init(t);
+        arf_set_ui_2exp_si(t, p, -ARB_ATAN_DYN_TAB_BITS * (level + 1));
+        arb_atan_arf_bb(atan_dyn_tab + i, t, wp);
+        atan_dyn_tab_prec[i] = wp;
+        arf_clear(t);
+    }
+
+    arb_set_round(res, atan_dyn_tab + i, prec);
+}
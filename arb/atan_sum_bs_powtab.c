@@ -23,16 +23,67 @@
 
 ******************************************************************************/
 
+#include <pthread.h>
 #include "arb.h"
 
+/* fork subtrees onto threads when (b - a) * r exceeds this */
+#define THREADED_CUTOFF 100000
+
 slong _arb_compute_bs_exponents(slong * tab, slong n);
 
 slong _arb_get_exp_pos(const slong * tab, slong step);
 
+typedef struct
+{
+    fmpz * T;
+    fmpz * Q;
+    mp_bitcnt_t * Qexp;
+    const slong * xexp;
+    const fmpz * xpow;
+    mp_bitcnt_t r;
+    slong a;
+    slong b;
+    slong num_threads;
+}
+bsplit_arg_t;
+
+typedef struct
+{
+    fmpz * z;
+    const fmpz * x;
+    const fmpz * y;
+}
+mul_arg_t;
+
+static void bsplit(fmpz_t T, fmpz_t Q, mp_bitcnt_t * Qexp,
+    const slong * xexp, const fmpz * xpow, mp_bitcnt_t r,
+    slong a, slong b, slong num_threads);
+
+static void *
+bsplit_worker(void * arg_ptr)
+{
+    bsplit_arg_t arg = *((bsplit_arg_t *) arg_ptr);
+
+    bsplit(arg.T, arg.Q, arg.Qexp, arg.xexp, arg.xpow, arg.r,
+        arg.a, arg.b, arg.num_threads);
+
+    flint_cleanup();
+    return NULL;
+}
+
+static void *
+mul_worker(void * arg_ptr)
+{
+    mul_arg_t arg = *((mul_arg_t *) arg_ptr);
+    fmpz_mul(arg.z, arg.x, arg.y);
+    flint_cleanup();
+    return NULL;
+}
+
 static void
 bsplit(fmpz_t T, fmpz_t Q, mp_bitcnt_t * Qexp,
     const slong * xexp,
-    const fmpz * xpow, mp_bitcnt_t r, slong a, slong b)
+    const fmpz * xpow, mp_bitcnt_t r, slong a, slong b, slong num_threads)
 {
     if (b - a == 1)
     {
@@ -63,6 +114,7 @@ bsplit(fmpz_t T, fmpz_t Q, mp_bitcnt_t * Qexp,
         slong step, m, i;
         mp_bitcnt_t Q2exp[1];
         fmpz_t Q2, T2;
+        int threaded;
 
         step = (b - a) / 2;
         m = a + step;
@@ -70,20 +122,74 @@ bsplit(fmpz_t T, fmpz_t Q, mp_bitcnt_t * Qexp,
         fmpz_init(Q2);
         fmpz_init(T2);
 
-        bsplit(T,  Q,  Qexp,  xexp, xpow, r, a, m);
-        bsplit(T2, Q2, Q2exp, xexp, xpow, r, m, b);
+        threaded = num_threads > 1 && (b - a) * (slong) r >= THREADED_CUTOFF;
 
-        fmpz_mul(T, T, Q2);
-        fmpz_mul_2exp(T, T, *Q2exp);
+        if (threaded)
+        {
+            pthread_t thread;
+            bsplit_arg_t arg;
+
+            arg.T = T2;
+            arg.Q = Q2;
+            arg.Qexp = Q2exp;
+            arg.xexp = xexp;
+            arg.xpow = xpow;
+            arg.r = r;
+            arg.a = m;
+            arg.b = b;
+            arg.num_threads = num_threads / 2;
+
+            pthread_create(&thread, NULL, bsplit_worker, &arg);
+            bsplit(T, Q, Qexp, xexp, xpow, r, a, m,
+                num_threads - num_threads / 2);
+            pthread_join(thread, NULL);
+        }
+        else
+        {
+            bsplit(T,  Q,  Qexp,  xexp, xpow, r, a, m, 1);
+            bsplit(T2, Q2, Q2exp, xexp, xpow, r, m, b, 1);
+        }
 
         /* find x^step in table */
         i = _arb_get_exp_pos(xexp, step);
-        fmpz_mul(T2, T2, Q);
-        fmpz_addmul(T, xpow + i, T2);
-        fmpz_clear(T2);
 
-        fmpz_mul(Q, Q, Q2);
+        if (threaded)
+        {
+            /* compute Q * Q2 while T is being updated (which reads Q) */
+            pthread_t thread;
+            mul_arg_t arg;
+            fmpz_t Q3;
+
+            fmpz_init(Q3);
+
+            arg.z = Q3;
+            arg.x = Q;
+            arg.y = Q2;
+
+            pthread_create(&thread, NULL, mul_worker, &arg);
+
+            fmpz_mul(T, T, Q2);
+            fmpz_mul_2exp(T, T, *Q2exp);
+            fmpz_mul(T2, T2, Q);
+            fmpz_addmul(T, xpow + i, T2);
+
+            pthread_join(thread, NULL);
+
+            fmpz_swap(Q, Q3);
+            fmpz_clear(Q3);
+        }
+        else
+        {
+            fmpz_mul(T, T, Q2);
+            fmpz_mul_2exp(T, T, *Q2exp);
+            fmpz_mul(T2, T2, Q);
+            fmpz_addmul(T, xpow + i, T2);
+
+            fmpz_mul(Q, Q, Q2);
+        }
+
         *Qexp = *Qexp + *Q2exp;
+        fmpz_clear(T2);
         fmpz_clear(Q2);
     }
 }
@@ -131,7 +237,7 @@ _arb_atan_sum_bs_powtab(fmpz_t T, fmpz_t Q, mp_bitcnt_t * Qexp,
         }
     }
 
-    bsplit(T, Q, Qexp, xexp, xpow, r, 0, N);
+    bsplit(T, Q, Qexp, xexp, xpow, r, 0, N, flint_get_num_threads());
 
     _fmpz_vec_clear(xpow, length);
     flint_free(xexp);
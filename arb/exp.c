@@ -92,11 +92,93 @@ arb_exp_arf_overflow(arb_t z, slong expbound, int negative, int minus_one, slong
     }
 }
 
+/* exp(x) = 2^n exp(p1/2^8) exp(p2/2^16) exp(r), |r| < 2^-16,
+   using the lazily computed tables */
+static void
+arb_exp_arf_dyn_tab(arb_t z, const arf_t x, slong mag, slong prec, int minus_one)
+{
+    slong wp;
+    ulong p, p1, p2;
+    fmpz_t n, t;
+    arf_t r;
+    arb_t u, v;
+    mag_t err, zbound;
+
+    wp = prec + 2 * ARB_EXP_DYN_TAB_BITS + 4;
+    if (minus_one && mag < 0)
+        wp += (-mag);
+
+    fmpz_init(n);
+    fmpz_init(t);
+    arf_init(r);
+    arb_init(u);
+    arb_init(v);
+    mag_init(err);
+    mag_init(zbound);
+
+    /* u = x - n log(2), approximately in [0, log(2)) */
+    arb_const_log2(u, wp + FLINT_MAX(mag, 0));
+    arf_div(r, x, arb_midref(u), FLINT_MAX(mag, 0) + 8, ARF_RND_FLOOR);
+    arf_get_fmpz(n, r, ARF_RND_FLOOR);
+    arb_mul_fmpz(v, u, n, wp + FLINT_MAX(mag, 0));
+    arb_set_arf(u, x);
+    arb_sub(u, u, v, wp);
+
+    /* split the midpoint as p1/2^8 + p2/2^16 + r */
+    if (arf_sgn(arb_midref(u)) > 0)
+    {
+        arf_get_fmpz_fixed_si(t, arb_midref(u), -2 * ARB_EXP_DYN_TAB_BITS);
+        p = fmpz_get_ui(t);
+        p = FLINT_MIN(p, (UWORD(1) << (2 * ARB_EXP_DYN_TAB_BITS)) - 1);
+    }
+    else
+    {
+        p = 0;
+    }
+
+    p1 = p >> ARB_EXP_DYN_TAB_BITS;
+    p2 = p & (ARB_EXP_DYN_TAB_NUM - 1);
+
+    arf_set_ui_2exp_si(r, p, -2 * ARB_EXP_DYN_TAB_BITS);
+    arf_sub(r, arb_midref(u), r, ARF_PREC_EXACT, ARF_RND_DOWN);
+
+    /* exp(u) = exp(mid(u)) (1 + eps), |eps| <= exp(rad(u)) - 1 */
+    mag_expm1(err, arb_radref(u));
+
+    arb_exp_arf_bb(z, r, wp, 0);
+    _arb_exp_dyn_tab(v, 0, p1, wp);
+    arb_mul(z, z, v, wp);
+    _arb_exp_dyn_tab(v, 1, p2, wp);
+    arb_mul(z, z, v, wp);
+
+    arb_get_mag(zbound, z);
+    mag_mul(err, err, zbound);
+    mag_add(arb_radref(z), arb_radref(z), err);
+
+    arb_mul_2exp_fmpz(z, z, n);
+
+    if (minus_one)
+        arb_sub_ui(z, z, 1, wp);
+
+    arb_set_round(z, z, prec);
+
+    fmpz_clear(n);
+    fmpz_clear(t);
+    arf_clear(r);
+    arb_clear(u);
+    arb_clear(v);
+    mag_clear(err);
+    mag_clear(zbound);
+}
+
 static void
 arb_exp_arf_fallback(arb_t z, const arf_t x, slong mag, slong prec, int minus_one)
 {
     if (mag > 64)
         arb_exp_arf_huge(z, x, mag, prec, minus_one);
+    else if (mag > -ARB_EXP_DYN_TAB_BITS && prec > ARB_EXP_TAB2_PREC
+            && prec <= ARB_EXP_DYN_TAB_MAX_PREC)
+        arb_exp_arf_dyn_tab(z, x, mag, prec, minus_one);
     else
         arb_exp_arf_bb(z, x, prec, minus_one);
 }
@@ -190,6 +272,18 @@ arb_exp_arf(arb_t z, const arf_t x, slong prec, int minus_one)
             return;
         }
 
+        /* low precision -- use hardware doubles */
+        if (prec <= ARB_D_PREC && !minus_one && exp <= 9)
+        {
+            double v;
+
+            if (_arf_get_d_fast(&v, x))
+            {
+                _arb_set_d_fast(z, _arb_exp_d(v), 1, prec);
+                return;
+            }
+        }
+
         /* Absolute working precision (NOT rounded to a limb multiple) */
         wp = prec + 8;
         if (minus_one && exp <= 0)
@@ -0,0 +1,102 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+
+void
+arb_exp_arith_progression(arb_ptr res, const arb_t a, const arb_t d,
+    slong n, slong prec)
+{
+    slong i, j, len, wp;
+    arb_ptr dpow;
+    arb_t am, dm, t, u;
+    mag_t r, err;
+
+    if (n <= 0)
+        return;
+
+    if (n == 1)
+    {
+        arb_exp(res, a, prec);
+        return;
+    }
+
+    /* direct evaluations at every len-th point, multiplication
+       by a table of powers of exp(d) in between */
+    len = FLINT_MIN(n, 4 * n_sqrt(n));
+    wp = prec + 2 * FLINT_BIT_COUNT(len) + 4;
+
+    dpow = _arb_vec_init(len);
+    arb_init(am);
+    arb_init(dm);
+    arb_init(t);
+    arb_init(u);
+    mag_init(r);
+    mag_init(err);
+
+    /* work with the exact midpoints, and add the propagated error
+       exp(a + k d) (exp(rad(a) + k rad(d)) - 1) at the end */
+    arb_get_mid_arb(am, a);
+    arb_get_mid_arb(dm, d);
+
+    arb_exp(t, dm, wp);
+    _arb_vec_set_powers(dpow, t, len, wp);
+
+    for (j = 0; j < n; j += len)
+    {
+        arb_mul_si(u, dm, j, wp);
+        arb_add(u, u, am, wp);
+        arb_exp(t, u, wp);
+
+        for (i = 0; i < len && j + i < n; i++)
+        {
+            if (i == 0)
+                arb_set_round(res + j, t, prec);
+            else
+                arb_mul(res + j + i, t, dpow + i, prec);
+        }
+    }
+
+    if (!arb_is_exact(a) || !arb_is_exact(d))
+    {
+        for (i = 0; i < n; i++)
+        {
+            mag_mul_ui(r, arb_radref(d), i);
+            mag_add(r, r, arb_radref(a));
+            mag_expm1(r, r);
+            arb_get_mag(err, res + i);
+            mag_mul(err, err, r);
+            mag_add(arb_radref(res + i), arb_radref(res + i), err);
+        }
+    }
+
+    _arb_vec_clear(dpow, len);
+    arb_clear(am);
+    arb_clear(dm);
+    arb_clear(t);
+    arb_clear(u);
+    mag_clear(r);
+    mag_clear(err);
+}
@@ -0,0 +1,96 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+
+/* 1.5 * 2^52, for rounding to the nearest integer */
+#define ROUND_MAGIC 6755399441055744.0
+
+#define INV_LOG2 1.4426950408889634
+/* log(2) = LOG2_HI + LOG2_LO + eps, where LOG2_HI has 32 significant
+   bits (so that k * LOG2_HI is exact for |k| < 2^21) and |eps| < 2^-86 */
+#define LOG2_HI 0.6931471803691238
+#define LOG2_LO 1.9082149292705877e-10
+
+static __inline__ double
+_pow2_d(double k)
+{
+#if FLINT_BITS == 64
+    union { double uf; mp_limb_t ul; } u;
+    u.ul = ((mp_limb_t) ((slong) k + 1023)) << 52;
+    return u.uf;
+#else
+    return ldexp(1.0, (int) k);
+#endif
+}
+
+/*
+    Requires |x| <= 700. Write x = k log(2) + r with |r| <= log(2)/2;
+    x - k LOG2_HI is exact, so r has an absolute error of at most
+    0.4 u where u = 2^-53. The Taylor series for exp(r) - 1 - r is
+    truncated after the r^13 term (error < 2^-57), and the remaining
+    rounding errors are bounded by 2.3 u, so the relative error
+    of the result is less than 6 u < 2^-50.
+*/
+static __inline__ double
+_exp_d_kernel(double x)
+{
+    double k, r, z, q;
+
+    k = (x * INV_LOG2 + ROUND_MAGIC) - ROUND_MAGIC;
+    r = (x - k * LOG2_HI) - k * LOG2_LO;
+    z = r * r;
+
+    q = 1.0 / 6227020800.0;
+    q = q * r + 1.0 / 479001600.0;
+    q = q * r + 1.0 / 39916800.0;
+    q = q * r + 1.0 / 3628800.0;
+    q = q * r + 1.0 / 362880.0;
+    q = q * r + 1.0 / 40320.0;
+    q = q * r + 1.0 / 5040.0;
+    q = q * r + 1.0 / 720.0;
+    q = q * r + 1.0 / 120.0;
+    q = q * r + 1.0 / 24.0;
+    q = q * r + 1.0 / 6.0;
+    q = q * r + 0.5;
+
+    return (1.0 + (r + z * q)) * _pow2_d(k);
+}
+
+double
+_arb_exp_d(double x)
+{
+    return _exp_d_kernel(x);
+}
+
+void
+_arb_exp_d_vec(double * y, const double * x, slong len)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        y[i] = _exp_d_kernel(x[i]);
+}
+
@@ -0,0 +1,147 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+#include "arb.h"
+
+/* Same scheme as _arb_exp_taylor_rs, but the outer loop runs over the
+   terms and the inner loop over the arguments, so that the choice of m,
+   the coefficient lookups and the denominator changes are shared and the
+   scratch space is allocated once. The arithmetic done for each argument
+   is identical to that in _arb_exp_taylor_rs. */
+
+#define TMP_ALLOC_LIMBS(size) TMP_ALLOC((size) * sizeof(mp_limb_t))
+
+#define FACTORIAL_TAB_SIZE 288
+
+extern const mp_limb_t factorial_tab_numer[FACTORIAL_TAB_SIZE];
+extern const mp_limb_t factorial_tab_denom[FACTORIAL_TAB_SIZE];
+
+void _arb_exp_taylor_rs_vec(mp_ptr y, mp_limb_t * error,
+    mp_srcptr x, slong num, mp_size_t xn, ulong N)
+{
+    mp_ptr s, t, xpow, si;
+    mp_limb_t new_denom, old_denom, c;
+    slong power, i, k, m;
+    int change_denom;
+
+    TMP_INIT;
+
+    if (N >= FACTORIAL_TAB_SIZE - 1)
+    {
+        flint_printf("_arb_exp_taylor_rs_vec: N too large!\n");
+        abort();
+    }
+
+    if (N <= 3)
+    {
+        for (i = 0; i < num; i++)
+            _arb_exp_taylor_rs(y + i * (xn + 1), error, x + i * xn, xn, N);
+        return;
+    }
+
+    TMP_START;
+
+    /* Choose m ~= sqrt(num_terms) (m must be even, >= 2) */
+    m = 2;
+    while (m * m < N)
+        m += 2;
+
+    xpow = TMP_ALLOC_LIMBS(num * (m + 1) * xn);
+    s = TMP_ALLOC_LIMBS(num * (xn + 2));
+    t = TMP_ALLOC_LIMBS(2 * xn + 2);
+
+    /* for each argument: | <temp> | x^m | x^(m-1) | ... | x^2 | x | */
+#define XPOW_WRITE(__i, __k) (xpow + ((__i) * (m + 1) + m - (__k)) * xn)
+#define XPOW_READ(__i, __k) (xpow + ((__i) * (m + 1) + m - (__k) + 1) * xn)
+
+    for (i = 0; i < num; i++)
+    {
+        flint_mpn_copyi(XPOW_READ(i, 1), x + i * xn, xn);
+        mpn_sqr(XPOW_WRITE(i, 2), XPOW_READ(i, 1), xn);
+
+        for (k = 4; k <= m; k += 2)
+        {
+            mpn_mul_n(XPOW_WRITE(i, k - 1), XPOW_READ(i, k / 2),
+                XPOW_READ(i, k / 2 - 1), xn);
+            mpn_sqr(XPOW_WRITE(i, k), XPOW_READ(i, k / 2), xn);
+        }
+    }
+
+    flint_mpn_zero(s, num * (xn + 2));
+
+    power = (N - 1) % m;
+
+    for (k = N - 1; k >= 0; k--)
+    {
+        c = factorial_tab_numer[k];
+        new_denom = factorial_tab_denom[k];
+        old_denom = factorial_tab_denom[k+1];
+
+        change_denom = (new_denom != old_denom && k < N - 1);
+
+        for (i = 0; i < num; i++)
+        {
+            si = s + i * (xn + 2);
+
+            /* change denominators */
+            if (change_denom)
+                mpn_divrem_1(si, 0, si, xn + 1, old_denom);
+
+            if (power == 0)
+            {
+                /* add c * x^0 -- only top limb is affected */
+                si[xn] += c;
+
+                /* Outer polynomial evaluation: multiply by x^m */
+                if (k != 0)
+                {
+                    mpn_mul(t, si, xn + 1, XPOW_READ(i, m), xn);
+                    flint_mpn_copyi(si, t + xn, xn + 1);
+                }
+            }
+            else
+            {
+                si[xn] += mpn_addmul_1(si, XPOW_READ(i, power), xn, c);
+            }
+        }
+
+        if (power == 0)
+            power = m - 1;
+        else
+            power--;
+    }
+
+    /* finally divide by denominator */
+    for (i = 0; i < num; i++)
+        mpn_divrem_1(y + i * (xn + 1), 0, s + i * (xn + 2), xn + 1,
+            factorial_tab_denom[0]);
+
+    /* error bound (ulp) */
+    error[0] = 2;
+
+#undef XPOW_WRITE
+#undef XPOW_READ
+
+    TMP_END;
+}
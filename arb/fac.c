@@ -23,16 +23,106 @@
 
 ******************************************************************************/
 
+#include <pthread.h>
 #include "arb.h"
 
+/* below this n, the exact factorial is not worth splitting up */
+#define THREADED_CUTOFF 20000
+
+typedef struct
+{
+    fmpz * res;
+    ulong a;
+    ulong len;
+}
+fac_arg_t;
+
+static void *
+fac_worker(void * arg_ptr)
+{
+    fac_arg_t arg = *((fac_arg_t *) arg_ptr);
+
+    fmpz_rfac_uiui(arg.res, arg.a, arg.len);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/* computes n! exactly, the chunk products being computed in parallel
+   and then combined pairwise so that the largest multiplications are
+   balanced */
+static void
+_arb_fac_ui_exact_threaded(fmpz_t res, ulong n, slong num_threads)
+{
+    pthread_t * threads;
+    fac_arg_t * args;
+    fmpz * parts;
+    ulong a, chunk;
+    slong i, num;
+
+    chunk = (n + num_threads - 1) / num_threads;
+    num = (n + chunk - 1) / chunk;
+
+    threads = flint_malloc(sizeof(pthread_t) * num);
+    args = flint_malloc(sizeof(fac_arg_t) * num);
+    parts = _fmpz_vec_init(num);
+
+    for (i = 0, a = 1; i < num; i++, a += chunk)
+    {
+        args[i].res = parts + i;
+        args[i].a = a;
+        args[i].len = FLINT_MIN(chunk, n + 1 - a);
+    }
+
+    for (i = 1; i < num; i++)
+        pthread_create(&threads[i], NULL, fac_worker, &args[i]);
+
+    fmpz_rfac_uiui(parts, args[0].a, args[0].len);
+
+    for (i = 1; i < num; i++)
+        pthread_join(threads[i], NULL);
+
+    while (num > 1)
+    {
+        for (i = 0; i < num / 2; i++)
+            fmpz_mul(parts + i, parts + 2 * i, parts + 2 * i + 1);
+
+        if (num % 2)
+            fmpz_swap(parts + i, parts + num - 1);
+
+        num = (num + 1) / 2;
+    }
+
+    fmpz_swap(res, parts);
+
+    _fmpz_vec_clear(parts, (n + chunk - 1) / chunk);
+    flint_free(threads);
+    flint_free(args);
+}
+
 void
 arb_fac_ui(arb_t x, ulong n, slong prec)
 {
     fmpz_t t;
+    slong num_threads;
+
     fmpz_init(t);
-    fmpz_set_ui(t, n);
-    fmpz_add_ui(t, t, 1);
-    arb_gamma_fmpz(x, t, prec);
+
+    num_threads = flint_get_num_threads();
+
+    /* same criterion for exact evaluation as in arb_gamma_fmpz */
+    if (num_threads > 1 && n >= THREADED_CUTOFF && n < UWORD_MAX &&
+        1.44265 * ((n + 1.0) * log(n + 1.0) - (n + 1.0)) < 15.0 * prec)
+    {
+        _arb_fac_ui_exact_threaded(t, n, num_threads);
+        arb_set_round_fmpz(x, t, prec);
+    }
+    else
+    {
+        fmpz_set_ui(t, n);
+        fmpz_add_ui(t, t, 1);
+        arb_gamma_fmpz(x, t, prec);
+    }
+
     fmpz_clear(t);
 }
-
@@ -367,6 +367,7 @@ void
 arb_gamma_stirling_eval(arb_t s, const arb_t z, slong nterms, int digamma, slong prec)
 {
     arb_t b, t, logz, zinv, zinv2;
+    arb_srcptr coeffs;
     mag_t err;
 
     slong k, term_prec;
@@ -389,6 +390,8 @@ arb_gamma_stirling_eval(arb_t s, const arb_t z, slong nterms, int digamma, slong
     {
         arb_mul(zinv2, zinv, zinv, prec);
 
+        coeffs = _arb_gamma_stirling_coeffs_cached(nterms, digamma, prec);
+
         z_mag = arf_get_d(arb_midref(logz), ARF_RND_UP) * 1.44269504088896;
 
         for (k = nterms - 1; k >= 1; k--)
@@ -407,8 +410,15 @@ arb_gamma_stirling_eval(arb_t s, const arb_t z, slong nterms, int digamma, slong
             else
                 arb_mul(s, s, zinv2, term_prec);
 
-            arb_gamma_stirling_coeff(b, k, digamma, term_prec);
-            arb_add(s, s, b, term_prec);
+            if (coeffs != NULL)
+            {
+                arb_add(s, s, coeffs + k, term_prec);
+            }
+            else
+            {
+                arb_gamma_stirling_coeff(b, k, digamma, term_prec);
+                arb_add(s, s, b, term_prec);
+            }
         }
 
         if (digamma)
@@ -654,7 +664,8 @@ arb_gamma_small_frac(arb_t y, unsigned int p, unsigned int q, slong prec)
     }
 }
 
-void
+/* returns 0 if gamma of the fractional part is not readily available */
+int
 arb_gamma_fmpq_outward(arb_t y, const fmpq_t x, slong prec)
 {
     fmpq_t a;
@@ -696,10 +707,14 @@ arb_gamma_fmpq_outward(arb_t y, const fmpq_t x, slong prec)
     {
         arb_gamma_small_frac(t, p, q, prec);
     }
-    else
+    else if (q > ARB_GAMMA_FMPQ_CACHE_MAX_Q ||
+        !_arb_gamma_fmpq_cached(t, p, q, prec))
     {
-        flint_printf("arb_gamma_fmpq: invalid fraction\n");
-        abort();
+        fmpq_clear(a);
+        fmpz_clear(n);
+        arb_clear(t);
+        arb_clear(u);
+        return 0;
     }
 
     /* argument reduction */
@@ -718,6 +733,7 @@ arb_gamma_fmpq_outward(arb_t y, const fmpq_t x, slong prec)
     fmpz_clear(n);
     arb_clear(t);
     arb_clear(u);
+    return 1;
 }
 
 void
@@ -757,6 +773,19 @@ arb_gamma_fmpq(arb_t y, const fmpq_t x, slong prec)
             return;
         }
     }
+    else if (q <= ARB_GAMMA_FMPQ_CACHE_MAX_Q && !COEFF_IS_MPZ(p))
+    {
+        /* for |p| below about 500 q, reduce to gamma(r/q) with 0 < r < q
+           using the functional equation and take that from a table,
+           if one has been built for this q */
+        p = FLINT_ABS(p);
+
+        if (p < q * 500.0 || p < q * (500.0 + 0.1 * prec * sqrt(prec)))
+        {
+            if (arb_gamma_fmpq_outward(y, x, prec))
+                return;
+        }
+    }
 
     arb_gamma_fmpq_stirling(y, x, prec);
 }
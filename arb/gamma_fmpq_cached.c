@@ -0,0 +1,157 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+
+void arb_gamma_fmpq_stirling(arb_t y, const fmpq_t a, slong prec);
+
+typedef struct
+{
+    ulong q;
+    slong prec;
+    arb_ptr tab;
+}
+gamma_fmpq_cache_entry;
+
+TLS_PREFIX gamma_fmpq_cache_entry * gamma_fmpq_cache = NULL;
+TLS_PREFIX slong gamma_fmpq_cache_next = 0;
+
+static void
+gamma_fmpq_cache_cleanup(void)
+{
+    slong i;
+
+    for (i = 0; i < ARB_GAMMA_FMPQ_CACHE_NUM; i++)
+        if (gamma_fmpq_cache[i].tab != NULL)
+            _arb_vec_clear(gamma_fmpq_cache[i].tab, gamma_fmpq_cache[i].q);
+
+    flint_free(gamma_fmpq_cache);
+    gamma_fmpq_cache = NULL;
+    gamma_fmpq_cache_next = 0;
+}
+
+/* sets tab[k] = gamma(k/q) for 0 < k < q with gcd(k, q) = 1, using the
+   Stirling series for k/q <= 1/2 and the reflection formula
+   gamma(x) = pi / (gamma(1-x) sin(pi x)) for the rest */
+static void
+_arb_gamma_fmpq_tab(arb_ptr tab, ulong q, slong prec)
+{
+    arb_t pi, t;
+    fmpq_t x;
+    ulong k;
+    slong wp;
+
+    wp = prec + 2 * FLINT_BIT_COUNT(q) + 8;
+
+    arb_init(pi);
+    arb_init(t);
+    fmpq_init(x);
+
+    arb_const_pi(pi, wp);
+
+    for (k = 1; k < q; k++)
+    {
+        if (n_gcd(k, q) != 1)
+            continue;
+
+        fmpz_set_ui(fmpq_numref(x), k);
+        fmpz_set_ui(fmpq_denref(x), q);
+
+        if (2 * k <= q)
+        {
+            arb_gamma_fmpq_stirling(tab + k, x, wp);
+        }
+        else
+        {
+            arb_sin_pi_fmpq(t, x, wp);
+            arb_mul(t, t, tab + q - k, wp);
+            arb_div(tab + k, pi, t, wp);
+        }
+    }
+
+    arb_clear(pi);
+    arb_clear(t);
+    fmpq_clear(x);
+}
+
+int
+_arb_gamma_fmpq_cached(arb_t y, ulong p, ulong q, slong prec)
+{
+    gamma_fmpq_cache_entry * entry;
+    slong i, wp;
+
+    if (gamma_fmpq_cache == NULL)
+    {
+        gamma_fmpq_cache = flint_calloc(ARB_GAMMA_FMPQ_CACHE_NUM,
+            sizeof(gamma_fmpq_cache_entry));
+        flint_register_cleanup_function(gamma_fmpq_cache_cleanup);
+    }
+
+    entry = NULL;
+
+    for (i = 0; i < ARB_GAMMA_FMPQ_CACHE_NUM; i++)
+    {
+        if (gamma_fmpq_cache[i].q == q)
+        {
+            entry = gamma_fmpq_cache + i;
+            break;
+        }
+    }
+
+    if (entry == NULL)
+    {
+        /* replace the oldest entry, but only build a table when the
+           same denominator is requested again */
+        entry = gamma_fmpq_cache + gamma_fmpq_cache_next;
+        gamma_fmpq_cache_next = (gamma_fmpq_cache_next + 1)
+            % ARB_GAMMA_FMPQ_CACHE_NUM;
+
+        if (entry->tab != NULL)
+            _arb_vec_clear(entry->tab, entry->q);
+
+        entry->q = q;
+        entry->prec = 0;
+        entry->tab = NULL;
+        return 0;
+    }
+
+    if (entry->tab == NULL)
+        entry->tab = _arb_vec_init(q);
+
+    if (entry->prec < prec)
+    {
+        /* round the precision up, so that callers increasing the
+           precision gradually do not rebuild the table every time */
+        wp = FLINT_MAX(prec, entry->prec + entry->prec / 4);
+        wp = ((wp + 63) / 64) * 64;
+
+        _arb_gamma_fmpq_tab(entry->tab, q, wp);
+        entry->prec = wp;
+    }
+
+    arb_set_round(y, entry->tab + p, prec);
+    return 1;
+}
+
@@ -0,0 +1,108 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+
+/* don't cache more than this many bits of coefficients per table */
+#define STIRLING_CACHE_BITS (WORD(1) << 24)
+
+void arb_gamma_stirling_coeff(arb_t b, ulong k, int digamma, slong prec);
+
+/* the coefficients B_{2k} / (2k(2k-1)) and (for digamma) B_{2k} / (2k),
+   for 1 <= k < len, from previous calls */
+TLS_PREFIX arb_ptr stirling_cache[2] = { NULL, NULL };
+TLS_PREFIX slong stirling_cache_len[2] = { 0, 0 };
+TLS_PREFIX slong stirling_cache_prec[2] = { 0, 0 };
+
+static void
+stirling_cache_cleanup(void)
+{
+    slong i;
+
+    for (i = 0; i < 2; i++)
+    {
+        _arb_vec_clear(stirling_cache[i], stirling_cache_len[i]);
+        stirling_cache[i] = NULL;
+        stirling_cache_len[i] = 0;
+        stirling_cache_prec[i] = 0;
+    }
+}
+
+/* returns a vector whose entry k, for 1 <= k < n, is the k-th Stirling
+   coefficient to at least prec bits, or NULL if the table would be too
+   large; the vector stays valid until the next call */
+arb_srcptr
+_arb_gamma_stirling_coeffs_cached(slong n, int digamma, slong prec)
+{
+    arb_ptr tab;
+    slong k, len, wp;
+
+    digamma = (digamma != 0);
+
+    if (n <= stirling_cache_len[digamma] &&
+        prec <= stirling_cache_prec[digamma])
+        return stirling_cache[digamma];
+
+    /* grow geometrically, to avoid rebuilding the table for slowly
+       increasing n or prec */
+    len = FLINT_MAX(n, 2 * stirling_cache_len[digamma]);
+    wp = prec;
+    if (wp > stirling_cache_prec[digamma])
+        wp = FLINT_MAX(wp, stirling_cache_prec[digamma] +
+            stirling_cache_prec[digamma] / 4);
+    else
+        wp = stirling_cache_prec[digamma];
+
+    if (len * wp > STIRLING_CACHE_BITS)
+    {
+        len = n;
+        wp = prec;
+
+        if (len * wp > STIRLING_CACHE_BITS)
+            return NULL;
+    }
+
+    if (stirling_cache[0] == NULL && stirling_cache[1] == NULL)
+        flint_register_cleanup_function(stirling_cache_cleanup);
+
+    tab = _arb_vec_init(len);
+
+    for (k = 1; k < len; k++)
+    {
+        if (k < stirling_cache_len[digamma] &&
+            wp <= stirling_cache_prec[digamma])
+            arb_swap(tab + k, stirling_cache[digamma] + k);
+        else
+            arb_gamma_stirling_coeff(tab + k, k, digamma, wp);
+    }
+
+    _arb_vec_clear(stirling_cache[digamma], stirling_cache_len[digamma]);
+    stirling_cache[digamma] = tab;
+    stirling_cache_len[digamma] = len;
+    stirling_cache_prec[digamma] = wp;
+
+    return tab;
+}
+
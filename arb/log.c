@@ -150,6 +150,18 @@ arb_log_arf(arb_t z, const arf_t x, slong prec)
         exp = ARF_EXP(x);
         negative = 0;
 
+        /* low precision -- use hardware doubles */
+        if (prec <= ARB_D_PREC)
+        {
+            double v;
+
+            if (_arf_get_d_fast(&v, x))
+            {
+                _arb_set_d_fast(z, _arb_log_d(v), 1, prec);
+                return;
+            }
+        }
+
         ARF_GET_MPN_READONLY(xp, xn, x);
 
         /* compute a c >= 0 such that |x-1| <= 2^(-c) if c > 0 */
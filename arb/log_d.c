@@ -0,0 +1,99 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+
+/* log(2) = LOG2_HI + LOG2_LO + eps, where LOG2_HI has 32 significant
+   bits (so that k * LOG2_HI is exact for |k| < 2^21) and |eps| < 2^-86 */
+#define LOG2_HI 0.6931471803691238
+#define LOG2_LO 1.9082149292705877e-10
+
+#define SQRT2 1.4142135623730951
+
+/*
+    Requires x to be a positive normal double. Write x = 2^e m with
+    sqrt(1/2) <= m <= sqrt(2) and evaluate log(m) = 2 atanh(s) where
+    s = (m-1)/(m+1), |s| <= 0.172. Here m-1 is exact and s has a relative
+    error of at most 2 u where u = 2^-53. The series for atanh is truncated
+    after the s^21 term (relative error < 2^-60), and the remaining rounding
+    errors give a relative error of at most 3.1 u for log(m). If e != 0,
+    then |log(x)| >= 0.34, and adding e log(2) in two parts costs at most
+    another 2.2 u, so the relative error is less than 6 u < 2^-50.
+*/
+static __inline__ double
+_log_d_kernel(double x)
+{
+    double e, m, s, z, p;
+
+#if FLINT_BITS == 64
+    union { double uf; mp_limb_t ul; } u;
+    u.uf = x;
+    e = (double) ((slong) (u.ul >> 52) - 1023);
+    u.ul = (u.ul & ((UWORD(1) << 52) - 1)) | (UWORD(1023) << 52);
+    m = u.uf;
+#else
+    int ie;
+    m = 2.0 * frexp(x, &ie);
+    e = ie - 1;
+#endif
+
+    if (m > SQRT2)
+    {
+        m *= 0.5;
+        e += 1.0;
+    }
+
+    s = (m - 1.0) / (m + 1.0);
+    z = s * s;
+
+    p = 2.0 / 21.0;
+    p = p * z + 2.0 / 19.0;
+    p = p * z + 2.0 / 17.0;
+    p = p * z + 2.0 / 15.0;
+    p = p * z + 2.0 / 13.0;
+    p = p * z + 2.0 / 11.0;
+    p = p * z + 2.0 / 9.0;
+    p = p * z + 2.0 / 7.0;
+    p = p * z + 2.0 / 5.0;
+    p = p * z + 2.0 / 3.0;
+
+    return e * LOG2_HI + (e * LOG2_LO + (2.0 * s + s * (z * p)));
+}
+
+double
+_arb_log_d(double x)
+{
+    return _log_d_kernel(x);
+}
+
+void
+_arb_log_d_vec(double * y, const double * x, slong len)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        y[i] = _log_d_kernel(x[i]);
+}
+
@@ -0,0 +1,136 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+
+#define DIVISOR(_k) (divisors[((_k)-1)/2])
+
+/* logarithms of the primes 2, 3, 5, ... from previous calls */
+TLS_PREFIX arb_ptr log_ui_vec_cache = NULL;
+TLS_PREFIX slong log_ui_vec_cache_len = 0;
+TLS_PREFIX slong log_ui_vec_cache_prec = 0;
+
+static void
+log_ui_vec_cache_cleanup(void)
+{
+    _arb_vec_clear(log_ui_vec_cache, log_ui_vec_cache_len);
+    log_ui_vec_cache = NULL;
+    log_ui_vec_cache_len = 0;
+    log_ui_vec_cache_prec = 0;
+}
+
+void
+arb_log_ui_vec(arb_ptr res, slong n, slong prec)
+{
+    slong * divisors;
+    slong i, j, k, ibound, wp, num_primes, prev, len;
+
+    if (n <= 0)
+        return;
+
+    arb_indeterminate(res);
+
+    if (n == 1)
+        return;
+
+    arb_zero(res + 1);
+
+    /* each logarithm is a sum of at most log2(n) prime logarithms */
+    wp = prec + FLINT_BIT_COUNT(FLINT_BIT_COUNT(n)) + 4;
+
+    /* smallest prime factor of each odd composite k < n */
+    divisors = flint_calloc(n / 2 + 1, sizeof(slong));
+    ibound = n_sqrt(n);
+    for (i = 3; i <= ibound; i += 2)
+        if (DIVISOR(i) == 0)
+            for (j = i * i; j < n; j += 2 * i)
+                DIVISOR(j) = i;
+
+    num_primes = 0;
+    prev = 0;
+
+    for (k = 2; k < n; k++)
+    {
+        if (k % 2 == 0 && k != 2)
+        {
+            arb_add(res + k, res + k / 2, res + 2, wp);
+        }
+        else if (k % 2 == 1 && DIVISOR(k) != 0)
+        {
+            arb_add(res + k, res + DIVISOR(k), res + k / DIVISOR(k), wp);
+        }
+        else
+        {
+            if (num_primes < log_ui_vec_cache_len &&
+                log_ui_vec_cache_prec >= wp)
+                arb_set_round(res + k, log_ui_vec_cache + num_primes, wp);
+            else
+                arb_log_ui_from_prev(res + k, k, res + prev, prev, wp);
+
+            prev = k;
+            num_primes++;
+        }
+    }
+
+    /* never shrink the cache when only the precision goes up */
+    len = FLINT_MAX(num_primes, log_ui_vec_cache_len);
+
+    if (num_primes != 0 &&
+        (num_primes > log_ui_vec_cache_len || wp > log_ui_vec_cache_prec)
+        && len * wp <= ARB_LOG_UI_VEC_CACHE_BITS)
+    {
+        arb_ptr cache;
+        ulong p, q;
+
+        cache = _arb_vec_init(len);
+
+        for (k = 2, i = 0; k < n; k++)
+            if (k == 2 || (k % 2 == 1 && DIVISOR(k) == 0))
+                arb_set(cache + i++, res + k);
+
+        /* recompute the remaining cached primes at the new precision */
+        for (p = prev; i < len; i++)
+        {
+            q = n_nextprime(p, 1);
+            arb_log_ui_from_prev(cache + i, q, cache + i - 1, p, wp);
+            p = q;
+        }
+
+        if (log_ui_vec_cache == NULL)
+            flint_register_cleanup_function(log_ui_vec_cache_cleanup);
+        else
+            _arb_vec_clear(log_ui_vec_cache, log_ui_vec_cache_len);
+
+        log_ui_vec_cache = cache;
+        log_ui_vec_cache_len = len;
+        log_ui_vec_cache_prec = wp;
+    }
+
+    for (k = 2; k < n; k++)
+        arb_set_round(res + k, res + k, prec);
+
+    flint_free(divisors);
+}
+
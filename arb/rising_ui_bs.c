@@ -23,11 +23,42 @@
 
 ******************************************************************************/
 
+#include <pthread.h>
 #include "arb.h"
 
+/* rough number of bit operations above which the two halves of
+   a node are computed in parallel */
+#define THREADED_CUTOFF 250000
+
+static void bsplit(arb_t y, const arb_t x, ulong a, ulong b, slong prec,
+    slong num_threads);
+
+typedef struct
+{
+    arb_ptr y;
+    arb_srcptr x;
+    ulong a;
+    ulong b;
+    slong prec;
+    slong num_threads;
+}
+bsplit_arg_t;
+
+static void *
+bsplit_worker(void * arg_ptr)
+{
+    bsplit_arg_t arg = *((bsplit_arg_t *) arg_ptr);
+
+    bsplit(arg.y, arg.x, arg.a, arg.b, arg.prec, arg.num_threads);
+
+    flint_cleanup();
+    return NULL;
+}
+
 /* assumes y and x are not aliased */
 static void
-bsplit(arb_t y, const arb_t x, ulong a, ulong b, slong prec)
+bsplit(arb_t y, const arb_t x, ulong a, ulong b, slong prec,
+    slong num_threads)
 {
     if (b - a == 1)
     {
@@ -59,8 +90,27 @@ bsplit(arb_t y, const arb_t x, ulong a, ulong b, slong prec)
         arb_init(t);
         arb_init(u);
 
-        bsplit(t, x, a, m, prec);
-        bsplit(u, x, m, b, prec);
+        if (num_threads > 1 && (b - a) * (double) prec > THREADED_CUTOFF)
+        {
+            pthread_t thread;
+            bsplit_arg_t arg;
+
+            arg.y = t;
+            arg.x = x;
+            arg.a = a;
+            arg.b = m;
+            arg.prec = prec;
+            arg.num_threads = num_threads / 2;
+
+            pthread_create(&thread, NULL, bsplit_worker, &arg);
+            bsplit(u, x, m, b, prec, num_threads - num_threads / 2);
+            pthread_join(thread, NULL);
+        }
+        else
+        {
+            bsplit(t, x, a, m, prec, 1);
+            bsplit(u, x, m, b, prec, 1);
+        }
 
         arb_mul(y, t, u, prec);
 
@@ -86,7 +136,7 @@ arb_rising_ui_bs(arb_t y, const arb_t x, ulong n, slong prec)
         slong wp = ARF_PREC_ADD(prec, FLINT_BIT_COUNT(n));
 
         arb_init(t);
-        bsplit(t, x, 0, n, wp);
+        bsplit(t, x, 0, n, wp, flint_get_num_threads());
         arb_set_round(y, t, prec);
         arb_clear(t);
     }
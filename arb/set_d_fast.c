@@ -0,0 +1,49 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+
+/* sets z to v with error 2^-ARB_D_ERR_BITS, relative to |v| if relative
+   is set and absolute otherwise, and rounds z to prec bits;
+   v must be nonzero if relative is set */
+void
+_arb_set_d_fast(arb_t z, double v, int relative, slong prec)
+{
+    int inexact;
+
+    arf_set_d(arb_midref(z), v);
+
+    if (relative)
+        mag_set_ui_2exp_si(arb_radref(z), 1,
+            ARF_EXP(arb_midref(z)) - ARB_D_ERR_BITS);
+    else
+        mag_set_ui_2exp_si(arb_radref(z), 1, -ARB_D_ERR_BITS);
+
+    inexact = arf_set_round(arb_midref(z), arb_midref(z), prec, ARB_RND);
+
+    if (inexact)
+        arf_mag_add_ulp(arb_radref(z), arb_radref(z), arb_midref(z), prec);
+}
+
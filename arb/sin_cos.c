@@ -197,6 +197,24 @@ arb_sin_cos_arf_new(arb_t zsin, arb_t zcos, const arf_t x, slong prec)
     exp = ARF_EXP(x);
     negative = ARF_SGNBIT(x);
 
+    /* low precision -- use hardware doubles */
+    if (prec <= ARB_D_PREC && exp <= 19)
+    {
+        double v, s, c;
+
+        if (_arf_get_d_fast(&v, x))
+        {
+            _arb_sin_cos_d(&s, &c, v);
+
+            /* only small arguments give a relative error for sin */
+            if (want_sin)
+                _arb_set_d_fast(zsin, s, fabs(v) < 0.75, prec);
+            if (want_cos)
+                _arb_set_d_fast(zcos, c, 0, prec);
+            return;
+        }
+    }
+
     /* Absolute working precision (NOT rounded to a limb multiple) */
     wp = prec + 8;
     if (want_sin && exp <= 0)
@@ -0,0 +1,113 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+
+/* 1.5 * 2^52, for rounding to the nearest integer */
+#define ROUND_MAGIC 6755399441055744.0
+
+#define TWO_OVER_PI 0.6366197723675814
+/* pi/2 = PIO2_HI + PIO2_LO + eps, where PIO2_HI has 33 significant
+   bits (so that k * PIO2_HI is exact for |k| < 2^20) and |eps| < 2^-87 */
+#define PIO2_HI 1.5707963267341256
+#define PIO2_LO 6.077100506506192e-11
+
+/*
+    Requires |x| < 2^19. Write x = k (pi/2) + r with |r| <= pi/4;
+    x - k PIO2_HI is exact, so r has an absolute error of at most
+    0.8 u where u = 2^-53. The Taylor series are truncated after the r^17
+    and r^16 terms (error < 2^-58), and the remaining rounding errors
+    give an absolute error of at most 3.3 u < 2^-50 for both sin(x) and
+    cos(x). If |x| < 3/4, then k = 0 and r = x exactly, and the relative
+    error of sin(x) is at most 2 u.
+*/
+static __inline__ void
+_sin_cos_d_kernel(double * s, double * c, double x)
+{
+    double k, r, z, sp, cp, sr, cr;
+    int q;
+
+    k = (x * TWO_OVER_PI + ROUND_MAGIC) - ROUND_MAGIC;
+    r = (x - k * PIO2_HI) - k * PIO2_LO;
+    z = r * r;
+
+    sp = -1.0 / 355687428096000.0;
+    sp = sp * z + 1.0 / 1307674368000.0;
+    sp = sp * z - 1.0 / 6227020800.0;
+    sp = sp * z + 1.0 / 39916800.0;
+    sp = sp * z - 1.0 / 362880.0;
+    sp = sp * z + 1.0 / 5040.0;
+    sp = sp * z - 1.0 / 120.0;
+    sp = sp * z + 1.0 / 6.0;
+    sr = r - r * (z * sp);
+
+    cp = 1.0 / 20922789888000.0;
+    cp = cp * z - 1.0 / 87178291200.0;
+    cp = cp * z + 1.0 / 479001600.0;
+    cp = cp * z - 1.0 / 3628800.0;
+    cp = cp * z + 1.0 / 40320.0;
+    cp = cp * z - 1.0 / 720.0;
+    cp = cp * z + 1.0 / 24.0;
+    cr = 1.0 - (0.5 * z - (z * z) * cp);
+
+    q = ((slong) k) & 3;
+
+    if (q == 0)
+    {
+        *s = sr;
+        *c = cr;
+    }
+    else if (q == 1)
+    {
+        *s = cr;
+        *c = -sr;
+    }
+    else if (q == 2)
+    {
+        *s = -sr;
+        *c = -cr;
+    }
+    else
+    {
+        *s = -cr;
+        *c = sr;
+    }
+}
+
+void
+_arb_sin_cos_d(double * s, double * c, double x)
+{
+    _sin_cos_d_kernel(s, c, x);
+}
+
+void
+_arb_sin_cos_d_vec(double * s, double * c, const double * x, slong len)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        _sin_cos_d_kernel(s + i, c + i, x[i]);
+}
+
@@ -101,6 +101,14 @@ _arb_cos_pi_fmpq_oct(arb_t c, const fmpz_t v, const fmpz_t w, slong prec)
     }
 }
 
+/* use the cache of tables cos(pi j / (2q)) */
+static int
+use_cache(const fmpq_t x)
+{
+    fmpz q = *fmpq_denref(x);
+    return !COEFF_IS_MPZ(q) && q > 6 && q <= ARB_SIN_COS_PI_CACHE_MAX_Q;
+}
+
 static unsigned int
 reduce_octant(fmpz_t v, fmpz_t w, const fmpq_t x)
 {
@@ -176,6 +184,11 @@ arb_sin_cos_pi_fmpq(arb_t s, arb_t c, const fmpq_t x, slong prec)
     fmpz_t v, w;
     unsigned int octant;
 
+    if (use_cache(x) && _arb_sin_cos_pi_fmpq_cached(s, c,
+            fmpz_fdiv_ui(fmpq_numref(x), 2 * *fmpq_denref(x)),
+            *fmpq_denref(x), prec))
+        return;
+
     fmpz_init(v);
     fmpz_init(w);
 
@@ -199,6 +212,11 @@ arb_sin_pi_fmpq(arb_t s, const fmpq_t x, slong prec)
     fmpz_t v, w;
     unsigned int octant;
 
+    if (use_cache(x) && _arb_sin_cos_pi_fmpq_cached(s, NULL,
+            fmpz_fdiv_ui(fmpq_numref(x), 2 * *fmpq_denref(x)),
+            *fmpq_denref(x), prec))
+        return;
+
     fmpz_init(v);
     fmpz_init(w);
 
@@ -222,6 +240,11 @@ arb_cos_pi_fmpq(arb_t c, const fmpq_t x, slong prec)
     fmpz_t v, w;
     unsigned int octant;
 
+    if (use_cache(x) && _arb_sin_cos_pi_fmpq_cached(NULL, c,
+            fmpz_fdiv_ui(fmpq_numref(x), 2 * *fmpq_denref(x)),
+            *fmpq_denref(x), prec))
+        return;
+
     fmpz_init(v);
     fmpz_init(w);
 
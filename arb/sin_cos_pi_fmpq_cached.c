@@ -0,0 +1,203 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+
+void mag_add_ui_2exp_si(mag_t, const mag_t, ulong, slong);
+
+typedef struct
+{
+    ulong q;
+    slong prec;
+    arb_ptr tab;
+}
+sin_cos_pi_cache_entry;
+
+TLS_PREFIX sin_cos_pi_cache_entry * sin_cos_pi_cache = NULL;
+TLS_PREFIX slong sin_cos_pi_cache_next = 0;
+
+static void
+sin_cos_pi_cache_cleanup(void)
+{
+    slong i;
+
+    for (i = 0; i < ARB_SIN_COS_PI_CACHE_NUM; i++)
+        if (sin_cos_pi_cache[i].tab != NULL)
+            _arb_vec_clear(sin_cos_pi_cache[i].tab, sin_cos_pi_cache[i].q + 1);
+
+    flint_free(sin_cos_pi_cache);
+    sin_cos_pi_cache = NULL;
+    sin_cos_pi_cache_next = 0;
+}
+
+/*
+Sets tab[j] = cos(pi j / (2q)) for 0 <= j <= q using the Chebyshev
+recurrence y_{j+1} = 2 x y_j - y_{j-1} on the midpoints, x = cos(pi/(2q)).
+
+If x is known with error eps and each step has rounding error at most
+rnd, the error e_j satisfies e_{j+1} = 2 x e_j - e_{j-1} + r_j with
+|r_j| <= 2 eps |y_j| + rnd <= 4 eps + rnd = R (as long as |e_j| <= 1),
+so e_j = U_{j-1}(x) e_1 + sum_{i<j} U_{j-1-i}(x) r_i. Since
+|U_m(x)| <= m + 1, we get |e_j| <= q eps + q^2 R / 2 for all j <= q.
+*/
+static void
+_arb_cos_pi_2q_tab(arb_ptr tab, ulong q, slong prec)
+{
+    slong j, wp;
+    arb_t x;
+    arf_t t;
+    mag_t err, R;
+
+    /* entries can be as small as sin(pi/(2q)) > 1/q, so we need
+       another log2(q) bits for full relative accuracy */
+    wp = prec + 3 * FLINT_BIT_COUNT(q) + 8;
+
+    arb_init(x);
+    arf_init(t);
+    mag_init(err);
+    mag_init(R);
+
+    arb_const_pi(x, wp + 8);
+    arb_div_ui(x, x, 2 * q, wp + 8);
+    arb_cos(x, x, wp + 8);
+    arb_set_round(x, x, wp);
+
+    /* R = 4 eps + 2^(1-wp), the latter bounding one ulp of |y| < 2 */
+    mag_mul_2exp_si(R, arb_radref(x), 2);
+    mag_add_ui_2exp_si(R, R, 1, 1 - wp);
+
+    mag_mul_ui(err, R, q);
+    mag_mul_ui(err, err, q);
+    mag_mul_2exp_si(err, err, -1);
+    mag_mul_ui(R, arb_radref(x), q);
+    mag_add(err, err, R);
+
+    arb_one(tab);
+    arb_set(tab + 1, x);
+
+    for (j = 2; j <= q; j++)
+    {
+        arf_mul(t, arb_midref(x), arb_midref(tab + j - 1),
+            ARF_PREC_EXACT, ARF_RND_DOWN);
+        arf_mul_2exp_si(t, t, 1);
+        arf_sub(arb_midref(tab + j), t, arb_midref(tab + j - 2),
+            wp, ARF_RND_DOWN);
+        mag_set(arb_radref(tab + j), err);
+    }
+
+    /* cos(pi/2) = 0 */
+    arb_zero(tab + q);
+
+    arb_clear(x);
+    arf_clear(t);
+    mag_clear(err);
+    mag_clear(R);
+}
+
+int
+_arb_sin_cos_pi_fmpq_cached(arb_t s, arb_t c, ulong p, ulong q, slong prec)
+{
+    sin_cos_pi_cache_entry * entry;
+    slong i, wp;
+    ulong k;
+    int negate_sin;
+
+    if (sin_cos_pi_cache == NULL)
+    {
+        sin_cos_pi_cache = flint_calloc(ARB_SIN_COS_PI_CACHE_NUM,
+            sizeof(sin_cos_pi_cache_entry));
+        flint_register_cleanup_function(sin_cos_pi_cache_cleanup);
+    }
+
+    entry = NULL;
+
+    for (i = 0; i < ARB_SIN_COS_PI_CACHE_NUM; i++)
+    {
+        if (sin_cos_pi_cache[i].q == q)
+        {
+            entry = sin_cos_pi_cache + i;
+            break;
+        }
+    }
+
+    if (entry == NULL)
+    {
+        /* replace the oldest entry, but only build a table when the
+           same denominator is requested again */
+        entry = sin_cos_pi_cache + sin_cos_pi_cache_next;
+        sin_cos_pi_cache_next = (sin_cos_pi_cache_next + 1)
+            % ARB_SIN_COS_PI_CACHE_NUM;
+
+        if (entry->tab != NULL)
+            _arb_vec_clear(entry->tab, entry->q + 1);
+
+        entry->q = q;
+        entry->prec = 0;
+        entry->tab = NULL;
+        return 0;
+    }
+
+    if (entry->tab == NULL)
+        entry->tab = _arb_vec_init(q + 1);
+
+    if (entry->prec < prec)
+    {
+        /* round the precision up so that slowly increasing precisions
+           only rebuild the table a logarithmic number of times */
+        wp = FLINT_MAX(prec, entry->prec + entry->prec / 4);
+        wp = ((wp + 63) / 64) * 64;
+        _arb_cos_pi_2q_tab(entry->tab, q, wp);
+        entry->prec = wp;
+    }
+
+    /* reduce to 0 <= p <= q using sin(pi (2q - p)/q) = -sin(pi p/q) */
+    p = p % (2 * q);
+    negate_sin = (p > q);
+    if (negate_sin)
+        p = 2 * q - p;
+
+    if (c != NULL)
+    {
+        if (2 * p <= q)
+        {
+            arb_set_round(c, entry->tab + 2 * p, prec);
+        }
+        else
+        {
+            arb_set_round(c, entry->tab + 2 * (q - p), prec);
+            arb_neg(c, c);
+        }
+    }
+
+    if (s != NULL)
+    {
+        k = FLINT_MIN(p, q - p);
+        arb_set_round(s, entry->tab + q - 2 * k, prec);
+        if (negate_sin)
+            arb_neg(s, s);
+    }
+
+    return 1;
+}
@@ -80,6 +80,45 @@ int main()
         fmpq_clear(V);
     }
 
+    /* the threaded version must give identical output */
+    for (iter = 0; iter < 20; iter++)
+    {
+        slong N;
+        fmpz_t x, T, Q, T2, Q2;
+        mp_bitcnt_t Qexp, Q2exp, r;
+
+        fmpz_init(x);
+        fmpz_init(T);
+        fmpz_init(Q);
+        fmpz_init(T2);
+        fmpz_init(Q2);
+
+        N = 1 + n_randint(state, 4000);
+        r = 1 + n_randint(state, 200);
+        fmpz_randtest(x, state, r);
+
+        flint_set_num_threads(1);
+        _arb_atan_sum_bs_powtab(T, Q, &Qexp, x, r, N);
+
+        flint_set_num_threads(2 + n_randint(state, 4));
+        _arb_atan_sum_bs_powtab(T2, Q2, &Q2exp, x, r, N);
+
+        if (!fmpz_equal(T, T2) || !fmpz_equal(Q, Q2) || Qexp != Q2exp)
+        {
+            flint_printf("FAIL (threaded)\n\n");
+            flint_printf("N = %wd\n\n", N);
+            flint_printf("r = %wu\n\n", r);
+            flint_printf("x = "); fmpz_print(x); flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_clear(x);
+        fmpz_clear(T);
+        fmpz_clear(Q);
+        fmpz_clear(T2);
+        fmpz_clear(Q2);
+    }
+
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
@@ -41,6 +41,7 @@ int main()
         slong accuracy, prec;
 
         prec = 2 + n_randint(state, 1 << n_randint(state, 18));
+        flint_set_num_threads(1 + n_randint(state, 4));
 
         arb_init(r);
         mpfr_init2(s, prec + 1000);
@@ -70,6 +71,7 @@ int main()
         mpfr_clear(s);
     }
 
+    flint_set_num_threads(1);
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
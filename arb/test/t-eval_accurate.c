@@ -0,0 +1,93 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("eval_accurate....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000; iter++)
+    {
+        arb_t x, y, z;
+        slong target, acc;
+        int success;
+
+        arb_init(x);
+        arb_init(y);
+        arb_init(z);
+
+        target = 2 + n_randint(state, 300);
+
+        arb_randtest(x, state, 1 + n_randint(state, 400), 4);
+        if (n_randint(state, 2))
+            arb_get_mid_arb(x, x);
+
+        arb_set(y, x);
+        if (n_randint(state, 2))
+            success = arb_gamma_accurate(y, y, target);
+        else
+            success = arb_gamma_accurate(y, x, target);
+
+        arb_gamma(z, x, target + 100);
+        acc = arb_rel_accuracy_bits(y);
+
+        if (!arb_overlaps(y, z) || (success && acc < target))
+        {
+            flint_printf("FAIL: overlap or accuracy\n\n");
+            flint_printf("target = %wd, acc = %wd\n\n", target, acc);
+            flint_printf("x = "); arb_printd(x, 30); flint_printf("\n\n");
+            flint_printf("y = "); arb_printd(y, 30); flint_printf("\n\n");
+            flint_printf("z = "); arb_printd(z, 30); flint_printf("\n\n");
+            abort();
+        }
+
+        /* an exact input away from the poles must succeed */
+        if (!success && arb_is_exact(x) && !arf_is_special(arb_midref(x))
+            && !(arf_is_int(arb_midref(x)) && arf_sgn(arb_midref(x)) <= 0))
+        {
+            flint_printf("FAIL: success\n\n");
+            flint_printf("target = %wd, acc = %wd\n\n", target, acc);
+            flint_printf("x = "); arb_printd(x, 30); flint_printf("\n\n");
+            flint_printf("y = "); arb_printd(y, 30); flint_printf("\n\n");
+            abort();
+        }
+
+        arb_clear(x);
+        arb_clear(y);
+        arb_clear(z);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
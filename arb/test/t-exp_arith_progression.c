@@ -0,0 +1,106 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("exp_arith_progression....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000; iter++)
+    {
+        arb_ptr res;
+        arb_t a, d, x, y;
+        slong k, n, prec, acc;
+
+        n = n_randint(state, 200);
+        prec = 2 + n_randint(state, 500);
+
+        res = _arb_vec_init(n);
+        arb_init(a);
+        arb_init(d);
+        arb_init(x);
+        arb_init(y);
+
+        arb_randtest(a, state, 1 + n_randint(state, 500), 3);
+        arb_randtest(d, state, 1 + n_randint(state, 500), 3);
+
+        if (n_randint(state, 2))
+        {
+            arb_get_mid_arb(a, a);
+            arb_get_mid_arb(d, d);
+        }
+
+        arb_exp_arith_progression(res, a, d, n, prec);
+
+        for (k = 0; k < n; k++)
+        {
+            arb_mul_si(x, d, k, prec + 100);
+            arb_add(x, x, a, prec + 100);
+            arb_exp(y, x, prec + 100);
+
+            if (!arb_overlaps(res + k, y))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("n = %wd, k = %wd, prec = %wd\n\n", n, k, prec);
+                flint_printf("a = "); arb_printd(a, 30); flint_printf("\n\n");
+                flint_printf("d = "); arb_printd(d, 30); flint_printf("\n\n");
+                flint_printf("res = "); arb_printd(res + k, 30); flint_printf("\n\n");
+                flint_printf("y = "); arb_printd(y, 30); flint_printf("\n\n");
+                abort();
+            }
+
+            acc = arb_rel_accuracy_bits(res + k);
+
+            if (arb_is_exact(a) && arb_is_exact(d) && acc < prec - 4)
+            {
+                flint_printf("FAIL: accuracy\n\n");
+                flint_printf("n = %wd, k = %wd, prec = %wd, acc = %wd\n\n",
+                    n, k, prec, acc);
+                flint_printf("a = "); arb_printd(a, 30); flint_printf("\n\n");
+                flint_printf("d = "); arb_printd(d, 30); flint_printf("\n\n");
+                flint_printf("res = "); arb_printd(res + k, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _arb_vec_clear(res, n);
+        arb_clear(a);
+        arb_clear(d);
+        arb_clear(x);
+        arb_clear(y);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
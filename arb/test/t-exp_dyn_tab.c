@@ -0,0 +1,98 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("exp_dyn_tab....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 300; iter++)
+    {
+        arf_t x;
+        arb_t a, b, c;
+        slong prec1, prec2, acc;
+
+        arf_init(x);
+        arb_init(a);
+        arb_init(b);
+        arb_init(c);
+
+        prec1 = ARB_EXP_TAB2_PREC + n_randint(state, 6000);
+        prec2 = 2 + n_randint(state, 12000);
+
+        arf_randtest(x, state, 1 + n_randint(state, 12000), 6);
+
+        /* one argument from the tables, exactly */
+        if (n_randint(state, 4) == 0)
+            arf_set_ui_2exp_si(x, n_randint(state, 256),
+                -8 * (slong) (1 + n_randint(state, 2)));
+
+        arb_set_arf(c, x);
+        arb_exp(a, c, prec1);
+        arb_exp_arf_bb(b, x, prec2, 0);
+
+        if (!arb_overlaps(a, b))
+        {
+            flint_printf("FAIL: overlap\n\n");
+            flint_printf("prec1 = %wd, prec2 = %wd\n\n", prec1, prec2);
+            flint_printf("x = "); arf_printd(x, 50); flint_printf("\n\n");
+            flint_printf("a = "); arb_printd(a, 50); flint_printf("\n\n");
+            flint_printf("b = "); arb_printd(b, 50); flint_printf("\n\n");
+            abort();
+        }
+
+        acc = arb_rel_accuracy_bits(a);
+
+        if (acc < prec1 - 4)
+        {
+            flint_printf("FAIL: accuracy\n\n");
+            flint_printf("prec1 = %wd, acc = %wd\n\n", prec1, acc);
+            flint_printf("x = "); arf_printd(x, 50); flint_printf("\n\n");
+            flint_printf("a = "); arb_printd(a, 50); flint_printf("\n\n");
+            abort();
+        }
+
+        arf_clear(x);
+        arb_clear(a);
+        arb_clear(b);
+        arb_clear(c);
+
+        /* free the tables now and then, so that they get rebuilt */
+        if (iter % 32 == 31)
+            flint_cleanup();
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
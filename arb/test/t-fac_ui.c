@@ -70,6 +70,38 @@ int main()
         arb_clear(c);
     }
 
+    /* exact evaluation with several threads */
+    for (iter = 0; iter < 10; iter++)
+    {
+        arb_t a, b;
+        ulong n;
+        slong prec;
+
+        arb_init(a);
+        arb_init(b);
+
+        n = 20000 + n_randint(state, 10000);
+        prec = 30000 + n_randint(state, 10000);
+
+        flint_set_num_threads(1);
+        arb_fac_ui(a, n, prec);
+        flint_set_num_threads(2 + n_randint(state, 3));
+        arb_fac_ui(b, n, prec);
+
+        if (!arb_equal(a, b))
+        {
+            flint_printf("FAIL: threads\n\n");
+            flint_printf("n = %wu, prec = %wd\n", n, prec);
+            flint_printf("a = "); arb_printd(a, 30); flint_printf("\n\n");
+            flint_printf("b = "); arb_printd(b, 30); flint_printf("\n\n");
+            abort();
+        }
+
+        arb_clear(a);
+        arb_clear(b);
+    }
+
+    flint_set_num_threads(1);
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
@@ -48,7 +48,7 @@ int main()
         fmpq_init(q);
 
         pp = -100 + n_randint(state, 10000);
-        qq = 1 + n_randint(state, 20);
+        qq = 1 + n_randint(state, n_randint(state, 2) ? 20 : 150);
         fmpq_set_si(q, pp, qq);
 
         arb_gamma_fmpq(r, q, prec);
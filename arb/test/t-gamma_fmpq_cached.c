@@ -0,0 +1,86 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("gamma_fmpq_cached....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 3000; iter++)
+    {
+        arb_t r, s;
+        ulong p, q;
+        slong prec;
+
+        prec = 2 + n_randint(state, 1 << n_randint(state, 11));
+
+        arb_init(r);
+        arb_init(s);
+
+        /* few distinct denominators, to exercise the cache */
+        q = 5 + n_randint(state, 3) + 31 * n_randint(state, 4);
+        do { p = 1 + n_randint(state, q - 1); } while (n_gcd(p, q) != 1);
+
+        if (_arb_gamma_fmpq_cached(r, p, q, prec))
+        {
+            arb_set_ui(s, p);
+            arb_div_ui(s, s, q, prec + 20);
+            arb_gamma(s, s, prec + 20);
+
+            if (!arb_overlaps(r, s))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("p = %wu, q = %wu, prec = %wd\n\n", p, q, prec);
+                flint_printf("r = "); arb_printd(r, 15); flint_printf("\n\n");
+                flint_printf("s = "); arb_printd(s, 15); flint_printf("\n\n");
+                abort();
+            }
+
+            if (arb_rel_accuracy_bits(r) < prec - 2)
+            {
+                flint_printf("FAIL: accuracy\n\n");
+                flint_printf("p = %wu, q = %wu, prec = %wd\n\n", p, q, prec);
+                flint_printf("r = "); arb_printd(r, 15); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        arb_clear(r);
+        arb_clear(s);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,93 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+
+void arb_gamma_stirling_coeff(arb_t b, ulong k, int digamma, slong prec);
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("gamma_stirling_coeffs_cached....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 3000; iter++)
+    {
+        arb_srcptr coeffs;
+        arb_t s;
+        slong i, k, n, prec;
+        int digamma;
+
+        /* interleave both tables with growing and shrinking n and prec */
+        n = 1 + n_randint(state, 1 << n_randint(state, 9));
+        prec = 2 + n_randint(state, 1 << n_randint(state, 12));
+        digamma = n_randint(state, 2);
+
+        arb_init(s);
+
+        coeffs = _arb_gamma_stirling_coeffs_cached(n, digamma, prec);
+
+        for (i = 0; i < 10 && coeffs != NULL && n > 1; i++)
+        {
+            k = 1 + n_randint(state, n - 1);
+
+            arb_gamma_stirling_coeff(s, k, digamma, prec + 20);
+
+            if (!arb_overlaps(coeffs + k, s))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("n = %wd, k = %wd, digamma = %d, prec = %wd\n\n",
+                    n, k, digamma, prec);
+                flint_printf("c = "); arb_printd(coeffs + k, 15); flint_printf("\n\n");
+                flint_printf("s = "); arb_printd(s, 15); flint_printf("\n\n");
+                abort();
+            }
+
+            if (arb_rel_accuracy_bits(coeffs + k) < prec - 2)
+            {
+                flint_printf("FAIL: accuracy\n\n");
+                flint_printf("n = %wd, k = %wd, digamma = %d, prec = %wd\n\n",
+                    n, k, digamma, prec);
+                flint_printf("c = "); arb_printd(coeffs + k, 15); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        arb_clear(s);
+
+        /* also check that the tables are rebuilt after a cleanup */
+        if (iter % 500 == 499)
+            flint_cleanup();
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
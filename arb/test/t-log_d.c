@@ -0,0 +1,84 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("log_d....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100000; iter++)
+    {
+        arf_t x;
+        arb_t a, b;
+        double v, w, y;
+
+        arf_init(x);
+        arb_init(a);
+        arb_init(b);
+
+        arf_randtest(x, state, 53, 4 + n_randint(state, 6));
+
+        if (!_arf_get_d_fast(&v, x) || v <= 0 || v == 1.0)
+        {
+            arf_clear(x);
+            arb_clear(a);
+            arb_clear(b);
+            continue;
+        }
+
+        y = _arb_log_d(v);
+        _arb_log_d_vec(&w, &v, 1);
+
+        _arb_set_d_fast(a, y, 1, 53);
+        arb_set_arf(b, x);
+        arb_log(b, b, 200);
+
+        if (!arb_contains(a, b) || w != y)
+        {
+            flint_printf("FAIL\n\n");
+            flint_printf("x = "); arf_printd(x, 20); flint_printf("\n\n");
+            flint_printf("a = "); arb_printd(a, 20); flint_printf("\n\n");
+            flint_printf("b = "); arb_printd(b, 20); flint_printf("\n\n");
+            abort();
+        }
+
+        arf_clear(x);
+        arb_clear(a);
+        arb_clear(b);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,88 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("log_ui_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000; iter++)
+    {
+        arb_ptr v;
+        arb_t t;
+        slong i, k, n, prec, acc;
+
+        n = n_randint(state, 3000);
+        prec = 2 + n_randint(state, 2000);
+
+        v = _arb_vec_init(n);
+        arb_init(t);
+
+        arb_log_ui_vec(v, n, prec);
+
+        for (i = 0; i < 10 && n > 1; i++)
+        {
+            k = 1 + n_randint(state, n - 1);
+
+            arb_log_ui(t, k, prec);
+
+            if (!arb_overlaps(t, v + k))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("n = %wd, prec = %wd, k = %wd\n\n", n, prec, k);
+                flint_printf("t = "); arb_printd(t, 50); flint_printf("\n\n");
+                flint_printf("v = "); arb_printd(v + k, 50); flint_printf("\n\n");
+                abort();
+            }
+
+            acc = arb_rel_accuracy_bits(v + k);
+
+            if (k > 1 && acc < prec - 4)
+            {
+                flint_printf("FAIL: accuracy\n\n");
+                flint_printf("n = %wd, prec = %wd, k = %wd, acc = %wd\n\n",
+                    n, prec, k, acc);
+                flint_printf("v = "); arb_printd(v + k, 50); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _arb_vec_clear(v, n);
+        arb_clear(t);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
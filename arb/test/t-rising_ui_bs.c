@@ -116,6 +116,42 @@ int main()
         arb_clear(y);
     }
 
+    /* threaded splitting must give the same result as serial */
+    for (iter = 0; iter < 100; iter++)
+    {
+        arb_t x, y, z;
+        ulong n;
+        slong prec;
+
+        arb_init(x);
+        arb_init(y);
+        arb_init(z);
+
+        arb_randtest(x, state, 1 + n_randint(state, 2000), 10);
+        n = n_randint(state, 2000);
+        prec = 2 + n_randint(state, 2000);
+
+        flint_set_num_threads(1);
+        arb_rising_ui_bs(y, x, n, prec);
+        flint_set_num_threads(1 + n_randint(state, 4));
+        arb_rising_ui_bs(z, x, n, prec);
+
+        if (!arb_equal(y, z))
+        {
+            flint_printf("FAIL: threads\n\n");
+            flint_printf("n = %wu, prec = %wd\n", n, prec);
+            flint_printf("x = "); arb_printd(x, 30); flint_printf("\n\n");
+            flint_printf("y = "); arb_printd(y, 30); flint_printf("\n\n");
+            flint_printf("z = "); arb_printd(z, 30); flint_printf("\n\n");
+            abort();
+        }
+
+        arb_clear(x);
+        arb_clear(y);
+        arb_clear(z);
+    }
+
+    flint_set_num_threads(1);
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
@@ -0,0 +1,93 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("sin_cos_d....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100000; iter++)
+    {
+        arf_t x;
+        arb_t a, b, c, d;
+        double v, s1, c1, s2, c2;
+
+        arf_init(x);
+        arb_init(a);
+        arb_init(b);
+        arb_init(c);
+        arb_init(d);
+
+        arf_randtest(x, state, 53, 2 + n_randint(state, 4));
+
+        if (!_arf_get_d_fast(&v, x) || fabs(v) >= 524288.0)
+        {
+            arf_clear(x);
+            arb_clear(a);
+            arb_clear(b);
+            arb_clear(c);
+            arb_clear(d);
+            continue;
+        }
+
+        _arb_sin_cos_d(&s1, &c1, v);
+        _arb_sin_cos_d_vec(&s2, &c2, &v, 1);
+
+        _arb_set_d_fast(a, s1, fabs(v) < 0.75, 53);
+        _arb_set_d_fast(b, c1, 0, 53);
+        arb_set_arf(c, x);
+        arb_sin_cos(c, d, c, 200);
+
+        if (!arb_contains(a, c) || !arb_contains(b, d) || s1 != s2 || c1 != c2)
+        {
+            flint_printf("FAIL\n\n");
+            flint_printf("x = "); arf_printd(x, 20); flint_printf("\n\n");
+            flint_printf("a = "); arb_printd(a, 20); flint_printf("\n\n");
+            flint_printf("b = "); arb_printd(b, 20); flint_printf("\n\n");
+            flint_printf("c = "); arb_printd(c, 20); flint_printf("\n\n");
+            flint_printf("d = "); arb_printd(d, 20); flint_printf("\n\n");
+            abort();
+        }
+
+        arf_clear(x);
+        arb_clear(a);
+        arb_clear(b);
+        arb_clear(c);
+        arb_clear(d);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
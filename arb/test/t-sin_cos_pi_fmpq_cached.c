@@ -0,0 +1,107 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("sin_cos_pi_fmpq_cached....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 10000; iter++)
+    {
+        arb_t s1, c1, s2, c2;
+        ulong p, q;
+        slong prec;
+        int ok;
+
+        prec = 2 + n_randint(state, 2000);
+
+        arb_init(s1);
+        arb_init(c1);
+        arb_init(s2);
+        arb_init(c2);
+
+        /* few distinct denominators, to exercise the cache */
+        q = 1 + n_randint(state, 2) + 37 * n_randint(state, 5);
+        p = n_randtest(state);
+
+        ok = _arb_sin_cos_pi_fmpq_cached(s1, c1, p, q, prec);
+
+        if (ok)
+        {
+            arb_const_pi(s2, prec + 20);
+            arb_mul_ui(s2, s2, p % (2 * q), prec + 20);
+            arb_div_ui(s2, s2, q, prec + 20);
+            arb_sin_cos(s2, c2, s2, prec + 20);
+
+            if (!arb_overlaps(s1, s2) || !arb_overlaps(c1, c2))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("p = %wu, q = %wu\n\n", p, q);
+                flint_printf("s1 = "); arb_printd(s1, 15); flint_printf("\n\n");
+                flint_printf("c1 = "); arb_printd(c1, 15); flint_printf("\n\n");
+                flint_printf("s2 = "); arb_printd(s2, 15); flint_printf("\n\n");
+                flint_printf("c2 = "); arb_printd(c2, 15); flint_printf("\n\n");
+                abort();
+            }
+
+            if ((!arb_is_zero(s1) && arb_rel_accuracy_bits(s1) < prec - 2) ||
+                (!arb_is_zero(c1) && arb_rel_accuracy_bits(c1) < prec - 2))
+            {
+                flint_printf("FAIL: accuracy\n\n");
+                flint_printf("p = %wu, q = %wu, prec = %wd\n\n", p, q, prec);
+                flint_printf("s1 = "); arb_printd(s1, 15); flint_printf("\n\n");
+                flint_printf("c1 = "); arb_printd(c1, 15); flint_printf("\n\n");
+                abort();
+            }
+
+            _arb_sin_cos_pi_fmpq_cached(s2, NULL, p, q, prec);
+            _arb_sin_cos_pi_fmpq_cached(NULL, c2, p, q, prec);
+
+            if (!arb_equal(s1, s2) || !arb_equal(c1, c2))
+            {
+                flint_printf("FAIL: sin or cos only\n\n");
+                flint_printf("p = %wu, q = %wu\n\n", p, q);
+                abort();
+            }
+        }
+
+        arb_clear(s1);
+        arb_clear(c1);
+        arb_clear(s2);
+        arb_clear(c2);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,143 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+#include "arb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("vec_exp....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000; iter++)
+    {
+        arb_ptr x, y, z, w;
+        slong i, len, prec;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        len = n_randint(state, 150);
+
+        switch (n_randint(state, 4))
+        {
+            case 0: prec = 2 + n_randint(state, 100); break;
+            case 1: prec = 2 + n_randint(state, 600); break;
+            case 2: prec = 2 + n_randint(state, 5000); break;
+            default: prec = 4000 + n_randint(state, 1000);
+        }
+
+        x = _arb_vec_init(len);
+        y = _arb_vec_init(len);
+        z = _arb_vec_init(len);
+        w = _arb_vec_init(len);
+
+        /* mostly exact arguments of moderate size, which take the
+           batched path, mixed with balls and special values */
+        for (i = 0; i < len; i++)
+        {
+            switch (n_randint(state, 8))
+            {
+                case 0: arb_randtest_special(x + i, state, 1 + n_randint(state, 2000), 12); break;
+                case 1: arb_randtest(x + i, state, 1 + n_randint(state, 2000), 8); break;
+                default: arb_randtest_exact(x + i, state, 1 + n_randint(state, 2000), 4);
+            }
+        }
+
+        _arb_vec_exp(y, x, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            arb_exp(z + i, x + i, prec);
+
+            if (!arb_overlaps(y + i, z + i))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                flint_printf("x = "); arb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("y = "); arb_printd(y + i, 30); flint_printf("\n\n");
+                flint_printf("z = "); arb_printd(z + i, 30); flint_printf("\n\n");
+                abort();
+            }
+
+            /* the shared number of terms can only lower the error */
+            if (arb_is_exact(x + i) && arb_is_finite(z + i) &&
+                arb_rel_accuracy_bits(y + i) < arb_rel_accuracy_bits(z + i) - 3)
+            {
+                flint_printf("FAIL: accuracy\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                flint_printf("x = "); arb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("y = "); arb_printd(y + i, 30); flint_printf("\n\n");
+                flint_printf("z = "); arb_printd(z + i, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        /* exp(x) exp(-x) = 1 */
+        for (i = 0; i < len; i++)
+            arb_neg(w + i, x + i);
+
+        _arb_vec_exp(w, w, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            arb_mul(z + i, y + i, w + i, prec);
+
+            if (!arb_contains_si(z + i, 1) && arb_is_finite(z + i))
+            {
+                flint_printf("FAIL: functional equation\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                flint_printf("x = "); arb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("z = "); arb_printd(z + i, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _arb_vec_exp(x, x, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            if (!arb_overlaps(x + i, y + i))
+            {
+                flint_printf("FAIL: aliasing\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                abort();
+            }
+        }
+
+        _arb_vec_clear(x, len);
+        _arb_vec_clear(y, len);
+        _arb_vec_clear(z, len);
+        _arb_vec_clear(w, len);
+    }
+
+    flint_set_num_threads(1);
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,119 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+#include "arb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("vec_lgamma....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000; iter++)
+    {
+        arb_ptr x, y;
+        arb_t t;
+        slong i, len, prec;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        len = n_randint(state, 60);
+        prec = 2 + n_randint(state, 300);
+
+        /* the second half holds the first half plus one */
+        x = _arb_vec_init(2 * len);
+        y = _arb_vec_init(2 * len);
+        arb_init(t);
+
+        for (i = 0; i < len; i++)
+        {
+            arb_randtest(x + i, state, 1 + n_randint(state, 300), 4);
+
+            if (n_randint(state, 2))
+                arb_abs(x + i, x + i);
+
+            arb_add_ui(x + len + i, x + i, 1, 1000);
+        }
+
+        _arb_vec_lgamma(y, x, 2 * len, prec);
+
+        for (i = 0; i < 2 * len; i++)
+        {
+            arb_lgamma(t, x + i, prec);
+
+            if (!arb_overlaps(y + i, t))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("len = %wd, i = %wd, prec = %wd\n\n", len, i, prec);
+                flint_printf("x = "); arb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("y = "); arb_printd(y + i, 30); flint_printf("\n\n");
+                flint_printf("t = "); arb_printd(t, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        /* lgamma(x+1) = lgamma(x) + log(x) */
+        for (i = 0; i < len; i++)
+        {
+            arb_log(t, x + i, prec);
+            arb_add(t, t, y + i, prec);
+
+            if (arb_is_finite(t) && !arb_overlaps(t, y + len + i))
+            {
+                flint_printf("FAIL: functional equation\n\n");
+                flint_printf("len = %wd, i = %wd, prec = %wd\n\n", len, i, prec);
+                flint_printf("x = "); arb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("t = "); arb_printd(t, 30); flint_printf("\n\n");
+                flint_printf("y = "); arb_printd(y + len + i, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _arb_vec_lgamma(x, x, 2 * len, prec);
+
+        for (i = 0; i < 2 * len; i++)
+        {
+            if (!arb_overlaps(x + i, y + i))
+            {
+                flint_printf("FAIL: aliasing\n\n");
+                flint_printf("len = %wd, i = %wd, prec = %wd\n\n", len, i, prec);
+                abort();
+            }
+        }
+
+        _arb_vec_clear(x, 2 * len);
+        _arb_vec_clear(y, 2 * len);
+        arb_clear(t);
+    }
+
+    flint_set_num_threads(1);
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,161 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+#include "arb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("vec_log....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000; iter++)
+    {
+        arb_ptr x, x2, y, y2, z;
+        slong i, len, prec;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        len = n_randint(state, 150);
+
+        switch (n_randint(state, 4))
+        {
+            case 0: prec = 2 + n_randint(state, 100); break;
+            case 1: prec = 2 + n_randint(state, 600); break;
+            case 2: prec = 2 + n_randint(state, 5000); break;
+            default: prec = 4000 + n_randint(state, 1000);
+        }
+
+        x = _arb_vec_init(len);
+        x2 = _arb_vec_init(len);
+        y = _arb_vec_init(len);
+        y2 = _arb_vec_init(len);
+        z = _arb_vec_init(len);
+
+        /* positive arguments, some close to 1, some small integers */
+        for (i = 0; i < len; i++)
+        {
+            switch (n_randint(state, 8))
+            {
+                case 0:
+                    arb_randtest_special(x + i, state, 1 + n_randint(state, 2000), 12);
+                    break;
+                case 1:
+                    arb_set_ui(x + i, 1 + n_randint(state, 1000));
+                    break;
+                case 2:
+                    arb_randtest_exact(x + i, state, 1 + n_randint(state, 2000), 4);
+                    arb_mul_2exp_si(x + i, x + i, -20 - n_randint(state, 40));
+                    arb_abs(x + i, x + i);
+                    arb_add_ui(x + i, x + i, 1, 2 * prec + 100);
+                    break;
+                case 3:
+                    arb_randtest(x + i, state, 1 + n_randint(state, 2000), 8);
+                    arb_abs(x + i, x + i);
+                    break;
+                default:
+                    arb_randtest_exact(x + i, state, 1 + n_randint(state, 2000), 8);
+                    arb_abs(x + i, x + i);
+            }
+
+            arb_mul(x2 + i, x + i, x + i, ARF_PREC_EXACT);
+        }
+
+        _arb_vec_log(y, x, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            arb_log(z + i, x + i, prec);
+
+            if (!arb_overlaps(y + i, z + i))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                flint_printf("x = "); arb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("y = "); arb_printd(y + i, 30); flint_printf("\n\n");
+                flint_printf("z = "); arb_printd(z + i, 30); flint_printf("\n\n");
+                abort();
+            }
+
+            /* the shared precision and number of terms can only lower
+               the error */
+            if (arb_is_exact(x + i) && arb_is_finite(z + i) &&
+                arb_rel_accuracy_bits(y + i) < arb_rel_accuracy_bits(z + i) - 3)
+            {
+                flint_printf("FAIL: accuracy\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                flint_printf("x = "); arb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("y = "); arb_printd(y + i, 30); flint_printf("\n\n");
+                flint_printf("z = "); arb_printd(z + i, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        /* log(x^2) = 2 log(x) */
+        _arb_vec_log(y2, x2, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            arb_mul_2exp_si(z + i, y + i, 1);
+
+            if (!arb_overlaps(z + i, y2 + i))
+            {
+                flint_printf("FAIL: functional equation\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                flint_printf("x = "); arb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("z = "); arb_printd(z + i, 30); flint_printf("\n\n");
+                flint_printf("y2 = "); arb_printd(y2 + i, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _arb_vec_log(x, x, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            if (!arb_overlaps(x + i, y + i))
+            {
+                flint_printf("FAIL: aliasing\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                abort();
+            }
+        }
+
+        _arb_vec_clear(x, len);
+        _arb_vec_clear(x2, len);
+        _arb_vec_clear(y, len);
+        _arb_vec_clear(y2, len);
+        _arb_vec_clear(z, len);
+    }
+
+    flint_set_num_threads(1);
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
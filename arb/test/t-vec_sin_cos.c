@@ -0,0 +1,171 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+#include "arb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("vec_sin_cos....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000; iter++)
+    {
+        arb_ptr x, s, c, s2, c2, t, u;
+        slong i, len, prec;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        len = n_randint(state, 150);
+
+        switch (n_randint(state, 4))
+        {
+            case 0: prec = 2 + n_randint(state, 100); break;
+            case 1: prec = 2 + n_randint(state, 600); break;
+            case 2: prec = 2 + n_randint(state, 5000); break;
+            default: prec = 4000 + n_randint(state, 1000);
+        }
+
+        x = _arb_vec_init(len);
+        s = _arb_vec_init(len);
+        c = _arb_vec_init(len);
+        s2 = _arb_vec_init(len);
+        c2 = _arb_vec_init(len);
+        t = _arb_vec_init(len);
+        u = _arb_vec_init(len);
+
+        /* small arguments change the working precision of a block */
+        for (i = 0; i < len; i++)
+        {
+            switch (n_randint(state, 8))
+            {
+                case 0:
+                    arb_randtest_special(x + i, state, 1 + n_randint(state, 2000), 12);
+                    break;
+                case 1:
+                    arb_randtest(x + i, state, 1 + n_randint(state, 2000), 8);
+                    break;
+                case 2:
+                    arb_randtest_exact(x + i, state, 1 + n_randint(state, 2000), 4);
+                    arb_mul_2exp_si(x + i, x + i, -n_randint(state, 50));
+                    break;
+                default:
+                    arb_randtest_exact(x + i, state, 1 + n_randint(state, 2000), 4);
+            }
+        }
+
+        _arb_vec_sin_cos(s, c, x, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            arb_sin_cos(t + i, u + i, x + i, prec);
+
+            if (!arb_overlaps(s + i, t + i) || !arb_overlaps(c + i, u + i))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                flint_printf("x = "); arb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("s = "); arb_printd(s + i, 30); flint_printf("\n\n");
+                flint_printf("t = "); arb_printd(t + i, 30); flint_printf("\n\n");
+                flint_printf("c = "); arb_printd(c + i, 30); flint_printf("\n\n");
+                flint_printf("u = "); arb_printd(u + i, 30); flint_printf("\n\n");
+                abort();
+            }
+
+            if (arb_is_exact(x + i) && arb_is_finite(t + i) &&
+                (arb_rel_accuracy_bits(s + i) < arb_rel_accuracy_bits(t + i) - 3 ||
+                 arb_rel_accuracy_bits(c + i) < arb_rel_accuracy_bits(u + i) - 3))
+            {
+                flint_printf("FAIL: accuracy\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                flint_printf("x = "); arb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("s = "); arb_printd(s + i, 30); flint_printf("\n\n");
+                flint_printf("t = "); arb_printd(t + i, 30); flint_printf("\n\n");
+                flint_printf("c = "); arb_printd(c + i, 30); flint_printf("\n\n");
+                flint_printf("u = "); arb_printd(u + i, 30); flint_printf("\n\n");
+                abort();
+            }
+
+            /* sin^2 + cos^2 = 1 */
+            arb_mul(t + i, s + i, s + i, prec);
+            arb_addmul(t + i, c + i, c + i, prec);
+
+            if (arb_is_finite(t + i) && !arb_contains_si(t + i, 1))
+            {
+                flint_printf("FAIL: sin^2 + cos^2\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                flint_printf("x = "); arb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("t = "); arb_printd(t + i, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        /* only one of the functions */
+        _arb_vec_sin_cos(s2, NULL, x, len, prec);
+        _arb_vec_sin_cos(NULL, c2, x, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            if (!arb_overlaps(s + i, s2 + i) || !arb_overlaps(c + i, c2 + i))
+            {
+                flint_printf("FAIL: NULL output\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                flint_printf("x = "); arb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("s2 = "); arb_printd(s2 + i, 30); flint_printf("\n\n");
+                flint_printf("c2 = "); arb_printd(c2 + i, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _arb_vec_sin_cos(x, u, x, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            if (!arb_overlaps(x + i, s + i) || !arb_overlaps(u + i, c + i))
+            {
+                flint_printf("FAIL: aliasing\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                abort();
+            }
+        }
+
+        _arb_vec_clear(x, len);
+        _arb_vec_clear(s, len);
+        _arb_vec_clear(c, len);
+        _arb_vec_clear(s2, len);
+        _arb_vec_clear(c2, len);
+        _arb_vec_clear(t, len);
+        _arb_vec_clear(u, len);
+    }
+
+    flint_set_num_threads(1);
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,329 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+#include <pthread.h>
+#include "arb.h"
+
+#define TMP_ALLOC_LIMBS(__n) TMP_ALLOC((__n) * sizeof(mp_limb_t))
+
+/* rough number of bit operations below which threading does not pay off */
+#define THREADED_CUTOFF 100000
+
+int _arf_set_mpn_fixed(arf_t z, mp_srcptr xp, mp_size_t xn, mp_size_t fixn, int negative, slong prec);
+
+/* whether arb_exp would use the table-based mpn code for this input;
+   everything else is passed on to arb_exp */
+static int
+_arb_vec_exp_use_tab(const arb_t x, slong prec)
+{
+    slong exp;
+
+    if (arf_is_special(arb_midref(x)) || !arb_is_finite(x))
+        return 0;
+
+    if (COEFF_IS_MPZ(ARF_EXP(arb_midref(x))))
+        return 0;
+
+    exp = ARF_EXP(arb_midref(x));
+
+    return exp >= -(prec / 2) - 4 && exp <= FLINT_MAX(128, 2 * prec)
+        && mag_cmp_2exp_si(arb_radref(x), 20) < 0;
+}
+
+/* Evaluates a block of at most a few dozen entries. The reductions
+   modulo log(2) and by the tables are done for all entries first, the
+   Taylor series for all reduced arguments are then evaluated together
+   with a common number of terms, and finally each entry is reconstructed
+   exactly as in arb_exp. */
+static void
+_arb_vec_exp_block(arb_ptr res, arb_srcptr x, slong len, slong prec,
+    slong wp, mp_size_t wn)
+{
+    slong wprounded, i, j, num, N, Nmax, r, finaln;
+    mp_ptr w, y, s, u, v, finalvalue;
+    mp_limb_t * p1, * p2, * error;
+    mp_limb_t q1bits, q2bits, error2, error3;
+    slong * idx;
+    fmpz * n;
+    mag_t rad, t;
+    int inexact;
+    TMP_INIT;
+
+    TMP_START;
+
+    wprounded = FLINT_BITS * wn;
+
+    w = TMP_ALLOC_LIMBS(len * wn);
+    y = TMP_ALLOC_LIMBS(len * (wn + 1));
+    s = TMP_ALLOC_LIMBS(len * wn);
+    u = TMP_ALLOC_LIMBS(2 * wn + 1);
+    v = TMP_ALLOC_LIMBS(wn + 1);
+    p1 = TMP_ALLOC_LIMBS(len);
+    p2 = TMP_ALLOC_LIMBS(len);
+    error = TMP_ALLOC_LIMBS(len);
+    idx = TMP_ALLOC(len * sizeof(slong));
+    n = _fmpz_vec_init(len);
+
+    mag_init(rad);
+    mag_init(t);
+
+    if (wp <= ARB_EXP_TAB1_PREC)
+    {
+        q1bits = ARB_EXP_TAB1_BITS;
+        q2bits = 0;
+    }
+    else
+    {
+        q1bits = ARB_EXP_TAB21_BITS;
+        q2bits = ARB_EXP_TAB21_BITS + ARB_EXP_TAB22_BITS;
+    }
+
+    /* argument reduction */
+    num = 0;
+    Nmax = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        mp_ptr wj = w + num * wn;
+
+        if (!_arb_vec_exp_use_tab(x + i, prec) ||
+            _arb_get_mpn_fixed_mod_log2(wj, n + num, error + num,
+                arb_midref(x + i), wn) == 0)
+        {
+            arb_exp(res + i, x + i, prec);
+            continue;
+        }
+
+        error[num] *= 3;
+
+        p1[num] = wj[wn-1] >> (FLINT_BITS - q1bits);
+        wj[wn-1] -= (p1[num] << (FLINT_BITS - q1bits));
+
+        if (q2bits != 0)
+        {
+            p2[num] = wj[wn-1] >> (FLINT_BITS - q2bits);
+            wj[wn-1] -= (p2[num] << (FLINT_BITS - q2bits));
+        }
+        else
+        {
+            p2[num] = 0;
+        }
+
+        r = _arb_mpn_leading_zeros(wj, wn);
+        N = _arb_exp_taylor_bound(-r, wp);
+        Nmax = FLINT_MAX(Nmax, N);
+
+        idx[num] = i;
+        num++;
+    }
+
+    /* Taylor series, with a number of terms sufficient for every entry */
+    if (num != 0)
+    {
+        if (Nmax < 60)
+        {
+            _arb_exp_taylor_rs_vec(y, &error2, w, num, wn, Nmax);
+
+            for (j = 0; j < num; j++)
+                error[j] += error2 + (UWORD(1) << (wprounded - wp));
+        }
+        else  /* compute cosh(a) from sinh(a) using a square root */
+        {
+            _arb_sin_cos_taylor_rs_vec(s, NULL, &error2, w, num, wn,
+                (Nmax + 1) / 2, 1, 0);
+
+            for (j = 0; j < num; j++)
+            {
+                mp_ptr yj = y + j * (wn + 1);
+
+                flint_mpn_copyi(yj, s + j * wn, wn);
+                error[j] += error2 + (UWORD(1) << (wprounded - wp));
+
+                /* 1 + sinh^2, with wn + 1 limbs */
+                mpn_sqr(u, yj, wn);
+                u[2 * wn] = 1;
+
+                /* cosh, with wn + 1 limbs */
+                mpn_sqrtrem(v, u, u, 2 * wn + 1);
+
+                /* exp = sinh + cosh */
+                yj[wn] = v[wn] + mpn_add_n(yj, yj, v, wn);
+
+                /* the error for cosh is at most the error for sinh
+                   plus 1 ulp from the square root */
+                error3 = error[j] + 1;
+                error[j] += error3;
+            }
+        }
+    }
+
+    /* multiply by the table entries and set the output */
+    for (j = 0; j < num; j++)
+    {
+        arb_ptr z = res + idx[j];
+        mp_ptr yj = y + j * (wn + 1);
+
+        mag_set(rad, arb_radref(x + idx[j]));
+
+        if (p1[j] == 0 && p2[j] == 0)
+        {
+            finalvalue = yj;
+            finaln = wn + 1;
+        }
+        else
+        {
+            /* Divide by 2 to get |t| <= 1 */
+            mpn_rshift(yj, yj, wn + 1, 1);
+            error[j] = (error[j] >> 1) + 2;
+
+            if (wp <= ARB_EXP_TAB1_PREC)
+            {
+                mpn_mul_n(u, yj,
+                    arb_exp_tab1[p1[j]] + ARB_EXP_TAB1_LIMBS - wn, wn);
+                error[j] += 4;
+                fmpz_add_ui(n + j, n + j, 2);
+            }
+            else
+            {
+                mpn_mul_n(u, arb_exp_tab21[p1[j]] + ARB_EXP_TAB2_LIMBS - wn,
+                             arb_exp_tab22[p2[j]] + ARB_EXP_TAB2_LIMBS - wn, wn);
+                flint_mpn_copyi(v, u + wn, wn);
+                mpn_mul_n(u, yj, v, wn);
+                error[j] += 6;
+                fmpz_add_ui(n + j, n + j, 3);
+            }
+
+            finalvalue = u + wn;
+            finaln = wn;
+        }
+
+        mag_set_ui_2exp_si(arb_radref(z), error[j], -wprounded);
+
+        inexact = _arf_set_mpn_fixed(arb_midref(z), finalvalue, finaln,
+            wn, 0, prec);
+        if (inexact)
+            arf_mag_add_ulp(arb_radref(z), arb_radref(z), arb_midref(z), prec);
+
+        arb_mul_2exp_fmpz(z, z, n + j);
+
+        /* exp(a+b) - exp(a) = exp(a) * (exp(b)-1) */
+        if (!mag_is_zero(rad))
+        {
+            mag_expm1(rad, rad);
+            arb_get_mag(t, z);
+            mag_addmul(arb_radref(z), rad, t);
+        }
+    }
+
+    _fmpz_vec_clear(n, len);
+    mag_clear(rad);
+    mag_clear(t);
+
+    TMP_END;
+}
+
+static void
+_arb_vec_exp_basecase(arb_ptr res, arb_srcptr x, slong len, slong prec)
+{
+    slong wp, wn, wprounded, i, block;
+
+    /* Absolute working precision, as in arb_exp */
+    wp = prec + 8;
+    wn = (wp + FLINT_BITS - 1) / FLINT_BITS;
+    wprounded = FLINT_BITS * wn;
+    wp = FLINT_MAX(wp, wprounded - (FLINT_BITS - 4));
+
+    /* hardware doubles or generic algorithm */
+    if (prec <= ARB_D_PREC || wp > ARB_EXP_TAB2_PREC)
+    {
+        for (i = 0; i < len; i++)
+            arb_exp(res + i, x + i, prec);
+        return;
+    }
+
+    /* keep the powers of all reduced arguments in a block in cache */
+    block = FLINT_MAX(1, FLINT_MIN(64, 1024 / wn));
+
+    for (i = 0; i < len; i += block)
+        _arb_vec_exp_block(res + i, x + i, FLINT_MIN(block, len - i),
+            prec, wp, wn);
+}
+
+typedef struct
+{
+    arb_ptr res;
+    arb_srcptr x;
+    slong len;
+    slong prec;
+}
+vec_exp_arg_t;
+
+static void *
+_arb_vec_exp_worker(void * arg_ptr)
+{
+    vec_exp_arg_t arg = *((vec_exp_arg_t *) arg_ptr);
+
+    _arb_vec_exp_basecase(arg.res, arg.x, arg.len, arg.prec);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+_arb_vec_exp(arb_ptr res, arb_srcptr x, slong len, slong prec)
+{
+    pthread_t * threads;
+    vec_exp_arg_t * args;
+    slong i, num_threads;
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), len);
+
+    if (num_threads <= 1 || len * (prec + 64) < THREADED_CUTOFF)
+    {
+        _arb_vec_exp_basecase(res, x, len, prec);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(vec_exp_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        slong a = (len * i) / num_threads;
+        slong b = (len * (i + 1)) / num_threads;
+
+        args[i].res = res + a;
+        args[i].x = x + a;
+        args[i].len = b - a;
+        args[i].prec = prec;
+
+        pthread_create(&threads[i], NULL, _arb_vec_exp_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
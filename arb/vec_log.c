@@ -0,0 +1,436 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+#include <pthread.h>
+#include "arb.h"
+
+#define TMP_ALLOC_LIMBS(__n) TMP_ALLOC((__n) * sizeof(mp_limb_t))
+
+/* rough number of bit operations below which threading does not pay off */
+#define THREADED_CUTOFF 100000
+
+/* largest number of extra bits of working precision used for an
+   argument close to 1 within a block; arguments closer to 1 are
+   passed on to arb_log */
+#define MAX_EXTRA_BITS 32
+
+int _arf_set_mpn_fixed(arf_t z, mp_srcptr xp, mp_size_t xn, mp_size_t fixn, int negative, slong prec);
+
+void mag_add_ui_2exp_si(mag_t z, const mag_t x, ulong y, slong e);
+
+/* returns c >= 0 such that |x-1| <= 2^(-c) if c > 0, as in arb_log_arf */
+static slong
+_arf_log_closeness_to_one(const arf_t x)
+{
+    slong exp, closeness_to_one, i;
+    mp_srcptr xp;
+    mp_size_t xn;
+
+    exp = ARF_EXP(x);
+    ARF_GET_MPN_READONLY(xp, xn, x);
+
+    closeness_to_one = 0;
+
+    if (exp == 0)
+    {
+        closeness_to_one = FLINT_BITS - FLINT_BIT_COUNT(~xp[xn - 1]);
+
+        if (closeness_to_one == FLINT_BITS)
+        {
+            for (i = xn - 2; i > 0 && xp[i] == LIMB_ONES; i--)
+                closeness_to_one += FLINT_BITS;
+
+            closeness_to_one += (FLINT_BITS - FLINT_BIT_COUNT(~xp[i]));
+        }
+    }
+    else if (exp == 1)
+    {
+        closeness_to_one = FLINT_BITS - FLINT_BIT_COUNT(xp[xn - 1] & (~LIMB_TOP));
+
+        if (closeness_to_one == FLINT_BITS)
+        {
+            for (i = xn - 2; xp[i] == 0; i--)
+                closeness_to_one += FLINT_BITS;
+
+            closeness_to_one += (FLINT_BITS - FLINT_BIT_COUNT(xp[i]));
+        }
+
+        closeness_to_one--;
+    }
+
+    return closeness_to_one;
+}
+
+/* returns the closeness to one if the midpoint is handled by the
+   table-based mpn code in arb_log, and -1 otherwise */
+static slong
+_arb_vec_log_use_tab(const arb_t x, slong prec)
+{
+    slong c;
+
+    if (arf_is_special(arb_midref(x)) || ARF_SGNBIT(arb_midref(x)) ||
+        ARF_IS_POW2(arb_midref(x)) || COEFF_IS_MPZ(ARF_EXP(arb_midref(x))))
+        return -1;
+
+    c = _arf_log_closeness_to_one(arb_midref(x));
+
+    if (c > MAX_EXTRA_BITS || 2 * c > prec + 1)
+        return -1;
+
+    return c;
+}
+
+/* Evaluates a block of at most a few dozen entries; see vec_exp.c.
+   The working precision is common to the block, taking into account
+   the argument closest to 1. */
+static void
+_arb_vec_log_block(arb_ptr res, arb_srcptr x, slong len, slong prec)
+{
+    slong wp, wn, i, j, num, numt, N, Nmax, exp, extra, c;
+    mp_srcptr xp;
+    mp_size_t xn, tn;
+    mp_ptr w, t, u, W, T;
+    mp_limb_t * p1, * p2, * error;
+    mp_limb_t q1bits, q2bits, error2, cy;
+    slong * idx, * slot, * r;
+    int negative, inexact;
+    mag_t err;
+    TMP_INIT;
+
+    /* Absolute working precision, as in arb_log */
+    extra = 0;
+    for (i = 0; i < len; i++)
+        extra = FLINT_MAX(extra, _arb_vec_log_use_tab(x + i, prec));
+
+    wp = prec + extra + 5;
+
+    if (wp > ARB_LOG_TAB2_PREC)
+    {
+        for (i = 0; i < len; i++)
+            arb_log(res + i, x + i, prec);
+        return;
+    }
+
+    wn = (wp + FLINT_BITS - 1) / FLINT_BITS;
+
+    TMP_START;
+
+    w = TMP_ALLOC_LIMBS(wn + 1);
+    t = TMP_ALLOC_LIMBS(wn + 1);
+    u = TMP_ALLOC_LIMBS(2 * wn + 1);
+    W = TMP_ALLOC_LIMBS(len * wn);
+    T = TMP_ALLOC_LIMBS(len * wn);
+    p1 = TMP_ALLOC_LIMBS(len);
+    p2 = TMP_ALLOC_LIMBS(len);
+    error = TMP_ALLOC_LIMBS(len);
+    idx = TMP_ALLOC(len * sizeof(slong));
+    slot = TMP_ALLOC(len * sizeof(slong));
+    r = TMP_ALLOC(len * sizeof(slong));
+
+    mag_init(err);
+
+    if (wp <= ARB_LOG_TAB1_PREC)
+    {
+        q1bits = ARB_LOG_TAB11_BITS;
+        q2bits = ARB_LOG_TAB11_BITS + ARB_LOG_TAB12_BITS;
+    }
+    else
+    {
+        q1bits = ARB_LOG_TAB21_BITS;
+        q2bits = ARB_LOG_TAB21_BITS + ARB_LOG_TAB22_BITS;
+    }
+
+    /* argument reduction */
+    num = numt = 0;
+    Nmax = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        if (_arb_vec_log_use_tab(x + i, prec) < 0)
+        {
+            arb_log(res + i, x + i, prec);
+            continue;
+        }
+
+        ARF_GET_MPN_READONLY(xp, xn, arb_midref(x + i));
+
+        /* read x-1 */
+        if (xn <= wn)
+        {
+            flint_mpn_zero(w, wn - xn);
+            mpn_lshift(w + wn - xn, xp, xn, 1);
+            error[num] = 0;
+        }
+        else
+        {
+            mpn_lshift(w, xp + xn - wn, wn, 1);
+            error[num] = 1;
+        }
+
+        /* First table-based argument reduction */
+        p1[num] = w[wn-1] >> (FLINT_BITS - q1bits);
+
+        /* Special case: covers logarithms of small integers */
+        if (xn == 1 && (w[wn-1] == (p1[num] << (FLINT_BITS - q1bits))))
+        {
+            p2[num] = 0;
+            slot[num] = -1;
+        }
+        else
+        {
+            /* log(1+w) = log(1+p/q) + log(1 + (qw-p)/(p+q)) */
+            w[wn] = mpn_mul_1(w, w, wn, UWORD(1) << q1bits) - p1[num];
+            mpn_divrem_1(w, 0, w, wn + 1, p1[num] + (UWORD(1) << q1bits));
+            error[num] += 1;
+
+            /* Second table-based argument reduction (fused with log->atanh
+               conversion) */
+            p2[num] = w[wn-1] >> (FLINT_BITS - q2bits);
+
+            u[2 * wn] = mpn_lshift(u + wn, w, wn, q2bits);
+            flint_mpn_zero(u, wn);
+            flint_mpn_copyi(t, u + wn, wn + 1);
+            t[wn] += p2[num] + (UWORD(1) << (q2bits + 1));
+            u[2 * wn] -= p2[num];
+            mpn_tdiv_q(w, u, 2 * wn + 1, t, wn + 1);
+
+            /* propagated error from 1 ulp error: 2 atanh'(1/3) = 2.25 */
+            error[num] += 3;
+
+            /* |w| <= 2^-r */
+            r[num] = _arb_mpn_leading_zeros(w, wn);
+
+            /* N >= (wp-r)/(2r) */
+            N = (wp - r[num] + (2*r[num]-1)) / (2*r[num]);
+            N = FLINT_MAX(N, 0);
+            Nmax = FLINT_MAX(Nmax, N);
+
+            flint_mpn_copyi(W + numt * wn, w, wn);
+            slot[num] = numt;
+            numt++;
+        }
+
+        idx[num] = i;
+        num++;
+    }
+
+    /* Taylor series, with a number of terms sufficient for every entry */
+    error2 = 0;
+    if (numt != 0)
+        _arb_atan_taylor_rs_vec(T, &error2, W, numt, wn, Nmax, 0);
+
+    /* add the table entries and set the output */
+    for (j = 0; j < num; j++)
+    {
+        arb_ptr z = res + idx[j];
+        arb_srcptr y = x + idx[j];
+
+        /* propagated error, computed before z is overwritten */
+        if (mag_is_zero(arb_radref(y)))
+        {
+            mag_zero(err);
+        }
+        else
+        {
+            arb_get_mag_lower_nonnegative(err, y);
+
+            if (mag_is_zero(err))
+            {
+                mag_inf(err);
+            }
+            else
+            {
+                mag_div(err, arb_radref(y), err);
+                mag_log1p(err, err);
+            }
+        }
+
+        exp = ARF_EXP(arb_midref(y));
+        negative = 0;
+
+        if (slot[j] < 0)
+        {
+            flint_mpn_zero(t, wn);
+        }
+        else
+        {
+            /* Multiply by 2 */
+            mpn_lshift(t, T + slot[j] * wn, wn, 1);
+            /* Taylor series evaluation error (multiply by 2) */
+            error[j] += error2 * 2;
+        }
+
+        /* Size of output number */
+        tn = wn;
+
+        /* First table lookup */
+        if (p1[j] != 0)
+        {
+            if (wp <= ARB_LOG_TAB1_PREC)
+                mpn_add_n(t, t, arb_log_tab11[p1[j]] + ARB_LOG_TAB1_LIMBS - tn, tn);
+            else
+                mpn_add_n(t, t, arb_log_tab21[p1[j]] + ARB_LOG_TAB2_LIMBS - tn, tn);
+            error[j]++;
+        }
+
+        /* Second table lookup */
+        if (p2[j] != 0)
+        {
+            if (wp <= ARB_LOG_TAB1_PREC)
+                mpn_add_n(t, t, arb_log_tab12[p2[j]] + ARB_LOG_TAB1_LIMBS - tn, tn);
+            else
+                mpn_add_n(t, t, arb_log_tab22[p2[j]] + ARB_LOG_TAB2_LIMBS - tn, tn);
+            error[j]++;
+        }
+
+        /* add exp * log(2) */
+        exp--;
+
+        if (exp > 0)
+        {
+            cy = mpn_addmul_1(t, arb_log_log2_tab + ARB_LOG_TAB2_LIMBS - tn, tn, exp);
+            t[tn] = cy;
+            tn += (cy != 0);
+            error[j] += exp;
+        }
+        else if (exp < 0)
+        {
+            t[tn] = 0;
+            u[tn] = mpn_mul_1(u, arb_log_log2_tab + ARB_LOG_TAB2_LIMBS - tn, tn, -exp);
+
+            if (mpn_cmp(t, u, tn + 1) >= 0)
+            {
+                mpn_sub_n(t, t, u, tn + 1);
+            }
+            else
+            {
+                mpn_sub_n(t, u, t, tn + 1);
+                negative = 1;
+            }
+
+            error[j] += (-exp);
+
+            tn += (t[tn] != 0);
+        }
+
+        /* The accumulated arithmetic error */
+        mag_set_ui_2exp_si(arb_radref(z), error[j], -wn * FLINT_BITS);
+
+        /* Truncation error from the Taylor series */
+        if (slot[j] >= 0)
+            mag_add_ui_2exp_si(arb_radref(z), arb_radref(z), 1,
+                -r[j]*(2*Nmax+1) + 1);
+
+        /* Set the midpoint */
+        inexact = _arf_set_mpn_fixed(arb_midref(z), t, tn, wn, negative, prec);
+        if (inexact)
+            arf_mag_add_ulp(arb_radref(z), arb_radref(z), arb_midref(z), prec);
+
+        mag_add(arb_radref(z), arb_radref(z), err);
+    }
+
+    mag_clear(err);
+
+    TMP_END;
+}
+
+static void
+_arb_vec_log_basecase(arb_ptr res, arb_srcptr x, slong len, slong prec)
+{
+    slong i, block, wn;
+
+    /* hardware doubles */
+    if (prec <= ARB_D_PREC)
+    {
+        for (i = 0; i < len; i++)
+            arb_log(res + i, x + i, prec);
+        return;
+    }
+
+    /* keep the powers of all reduced arguments in a block in cache */
+    wn = (prec + 5 + MAX_EXTRA_BITS + FLINT_BITS - 1) / FLINT_BITS;
+    block = FLINT_MAX(1, FLINT_MIN(64, 1024 / wn));
+
+    for (i = 0; i < len; i += block)
+        _arb_vec_log_block(res + i, x + i, FLINT_MIN(block, len - i), prec);
+}
+
+typedef struct
+{
+    arb_ptr res;
+    arb_srcptr x;
+    slong len;
+    slong prec;
+}
+vec_log_arg_t;
+
+static void *
+_arb_vec_log_worker(void * arg_ptr)
+{
+    vec_log_arg_t arg = *((vec_log_arg_t *) arg_ptr);
+
+    _arb_vec_log_basecase(arg.res, arg.x, arg.len, arg.prec);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+_arb_vec_log(arb_ptr res, arb_srcptr x, slong len, slong prec)
+{
+    pthread_t * threads;
+    vec_log_arg_t * args;
+    slong i, num_threads;
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), len);
+
+    if (num_threads <= 1 || len * (prec + 64) < THREADED_CUTOFF)
+    {
+        _arb_vec_log_basecase(res, x, len, prec);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(vec_log_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        slong a = (len * i) / num_threads;
+        slong b = (len * (i + 1)) / num_threads;
+
+        args[i].res = res + a;
+        args[i].x = x + a;
+        args[i].len = b - a;
+        args[i].prec = prec;
+
+        pthread_create(&threads[i], NULL, _arb_vec_log_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
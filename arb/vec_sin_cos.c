@@ -0,0 +1,449 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+#include <pthread.h>
+#include "arb.h"
+#include "mpn_extras.h"
+
+#define TMP_ALLOC_LIMBS(__n) TMP_ALLOC((__n) * sizeof(mp_limb_t))
+
+/* rough number of bit operations below which threading does not pay off */
+#define THREADED_CUTOFF 100000
+
+/* largest number of extra bits of working precision used for a small
+   argument of the sine within a block; smaller arguments are passed on
+   to arb_sin_cos */
+#define MAX_EXTRA_BITS 32
+
+#define MAGLIM(prec) FLINT_MAX(65536, (4*prec))
+
+int _arf_set_mpn_fixed(arf_t z, mp_srcptr xp, mp_size_t xn, mp_size_t fixn, int negative, slong prec);
+
+/* whether the midpoint is handled by the table-based mpn code
+   in arb_sin_cos */
+static int
+_arb_vec_sin_cos_use_tab(const arb_t x, int want_sin, int want_cos,
+    slong prec)
+{
+    slong exp;
+
+    if (arf_is_special(arb_midref(x)) ||
+        COEFF_IS_MPZ(ARF_EXP(arb_midref(x))))
+        return 0;
+
+    exp = ARF_EXP(arb_midref(x));
+
+    if (exp > MAGLIM(prec))
+        return 0;
+
+    if (want_sin)
+        return exp >= -MAX_EXTRA_BITS &&
+            exp >= (want_cos ? -(prec / 2) - 2 : -(prec / 3) - 2);
+    else
+        return exp >= -(prec / 2) - 2;
+}
+
+static void
+_arb_vec_sin_cos_one(arb_t s, arb_t c, const arb_t x, slong prec)
+{
+    if (s == NULL)
+        arb_cos(c, x, prec);
+    else if (c == NULL)
+        arb_sin(s, x, prec);
+    else
+        arb_sin_cos(s, c, x, prec);
+}
+
+/* Evaluates a block of at most a few dozen entries; see vec_exp.c.
+   The working precision is common to the block, taking into account
+   the smallest argument when the sine is wanted. */
+static void
+_arb_vec_sin_cos_block(arb_ptr s, arb_ptr c, arb_srcptr x, slong len,
+    slong prec)
+{
+    int want_sin, want_cos, inexact;
+    int sinnegative, cosnegative, swapsincos;
+    slong wp, wn, wprounded, i, j, num, N, Nmax, r, extra;
+    mp_ptr w, sina, cosa, sinb, cosb, ta, tb, sinptr, cosptr;
+    mp_limb_t * p1, * p2, * error;
+    mp_limb_t q1bits, q2bits, error2;
+    int * octant, * negative;
+    slong * idx;
+    mag_t rad;
+    TMP_INIT;
+
+    want_sin = (s != NULL);
+    want_cos = (c != NULL);
+
+    /* Absolute working precision, as in arb_sin_cos */
+    extra = 0;
+    if (want_sin)
+    {
+        for (i = 0; i < len; i++)
+            if (_arb_vec_sin_cos_use_tab(x + i, want_sin, want_cos, prec))
+                extra = FLINT_MAX(extra, -ARF_EXP(arb_midref(x + i)));
+    }
+
+    wp = prec + 8 + extra;
+    wn = (wp + FLINT_BITS - 1) / FLINT_BITS;
+    wprounded = FLINT_BITS * wn;
+    wp = FLINT_MAX(wp, wprounded - (FLINT_BITS - 4));
+
+    if (wp > ARB_SIN_COS_TAB2_PREC)
+    {
+        for (i = 0; i < len; i++)
+            _arb_vec_sin_cos_one(want_sin ? s + i : NULL,
+                want_cos ? c + i : NULL, x + i, prec);
+        return;
+    }
+
+    TMP_START;
+
+    w = TMP_ALLOC_LIMBS(len * wn);
+    sina = TMP_ALLOC_LIMBS(len * wn);
+    cosa = TMP_ALLOC_LIMBS(len * wn);
+    sinb = TMP_ALLOC_LIMBS(wn);
+    cosb = TMP_ALLOC_LIMBS(wn);
+    ta = TMP_ALLOC_LIMBS(2 * wn);
+    tb = TMP_ALLOC_LIMBS(2 * wn);
+    p1 = TMP_ALLOC_LIMBS(len);
+    p2 = TMP_ALLOC_LIMBS(len);
+    error = TMP_ALLOC_LIMBS(len);
+    octant = TMP_ALLOC(len * sizeof(int));
+    negative = TMP_ALLOC(len * sizeof(int));
+    idx = TMP_ALLOC(len * sizeof(slong));
+
+    mag_init(rad);
+
+    if (wp <= ARB_SIN_COS_TAB1_PREC)
+    {
+        q1bits = ARB_SIN_COS_TAB1_BITS;
+        q2bits = 0;
+    }
+    else
+    {
+        q1bits = ARB_SIN_COS_TAB21_BITS;
+        q2bits = ARB_SIN_COS_TAB21_BITS + ARB_SIN_COS_TAB22_BITS;
+    }
+
+    /* argument reduction */
+    num = 0;
+    Nmax = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        mp_ptr wj = w + num * wn;
+
+        if (!_arb_vec_sin_cos_use_tab(x + i, want_sin, want_cos, prec) ||
+            _arb_get_mpn_fixed_mod_pi4(wj, NULL, octant + num, error + num,
+                arb_midref(x + i), wn) == 0)
+        {
+            _arb_vec_sin_cos_one(want_sin ? s + i : NULL,
+                want_cos ? c + i : NULL, x + i, prec);
+            continue;
+        }
+
+        negative[num] = ARF_SGNBIT(arb_midref(x + i));
+
+        p1[num] = wj[wn-1] >> (FLINT_BITS - q1bits);
+        wj[wn-1] -= (p1[num] << (FLINT_BITS - q1bits));
+
+        if (q2bits != 0)
+        {
+            p2[num] = wj[wn-1] >> (FLINT_BITS - q2bits);
+            wj[wn-1] -= (p2[num] << (FLINT_BITS - q2bits));
+        }
+        else
+        {
+            p2[num] = 0;
+        }
+
+        r = _arb_mpn_leading_zeros(wj, wn);
+        N = _arb_exp_taylor_bound(-r, wp);
+        /* the summation for sin/cos is actually done to (2N-1)! */
+        N = (N + 1) / 2;
+        Nmax = FLINT_MAX(Nmax, N);
+
+        idx[num] = i;
+        num++;
+    }
+
+    /* Taylor series, with a number of terms sufficient for every entry */
+    if (num != 0)
+    {
+        if (Nmax < 14)
+        {
+            _arb_sin_cos_taylor_rs_vec(sina, cosa, &error2, w, num, wn,
+                Nmax, 0, 1);
+
+            for (j = 0; j < num; j++)
+                error[j] += error2 + (UWORD(1) << (wprounded - wp));
+        }
+        else  /* compute cos(a) from sin(a) using a square root */
+        {
+            _arb_sin_cos_taylor_rs_vec(sina, NULL, &error2, w, num, wn,
+                Nmax, 1, 1);
+
+            for (j = 0; j < num; j++)
+            {
+                error[j] += error2 + (UWORD(1) << (wprounded - wp));
+
+                if (flint_mpn_zero_p(sina + j * wn, wn))
+                {
+                    flint_mpn_store(cosa + j * wn, wn, LIMB_ONES);
+                    error[j] = FLINT_MAX(error[j], 1);
+                }
+                else
+                {
+                    mpn_sqr(ta, sina + j * wn, wn);
+                    /* 1 - s^2 (negation guaranteed to have borrow) */
+                    mpn_neg(ta, ta, 2 * wn);
+                    mpn_sqrtrem(cosa + j * wn, ta, ta, 2 * wn);
+                    error[j] += 1;
+                }
+            }
+        }
+    }
+
+    /* combine with the table entries and set the output */
+    for (j = 0; j < num; j++)
+    {
+        mp_ptr sinaj = sina + j * wn;
+        mp_ptr cosaj = cosa + j * wn;
+        mp_ptr wj = w + j * wn;
+
+        i = idx[j];
+
+        if (mag_cmp_2exp_si(arb_radref(x + i), 1) > 0)
+            mag_set_ui_2exp_si(rad, 1, 1);
+        else
+            mag_set(rad, arb_radref(x + i));
+
+        sinnegative = (octant[j] >= 4) ^ negative[j];
+        cosnegative = (octant[j] >= 2 && octant[j] <= 5);
+        swapsincos = (octant[j] == 1 || octant[j] == 2 ||
+                      octant[j] == 5 || octant[j] == 6);
+
+        if (p1[j] == 0 && p2[j] == 0)  /* no table lookups */
+        {
+            sinptr = sinaj;
+            cosptr = cosaj;
+        }
+        else if (p1[j] == 0 || p2[j] == 0)    /* only one table lookup */
+        {
+            mp_srcptr sinc, cosc;
+
+            if (wp <= ARB_SIN_COS_TAB1_PREC)  /* must be in table 1 */
+            {
+                sinc = arb_sin_cos_tab1[2 * p1[j]] + ARB_SIN_COS_TAB1_LIMBS - wn;
+                cosc = arb_sin_cos_tab1[2 * p1[j] + 1] + ARB_SIN_COS_TAB1_LIMBS - wn;
+            }
+            else if (p1[j] != 0)
+            {
+                sinc = arb_sin_cos_tab21[2 * p1[j]] + ARB_SIN_COS_TAB2_LIMBS - wn;
+                cosc = arb_sin_cos_tab21[2 * p1[j] + 1] + ARB_SIN_COS_TAB2_LIMBS - wn;
+            }
+            else
+            {
+                sinc = arb_sin_cos_tab22[2 * p2[j]] + ARB_SIN_COS_TAB2_LIMBS - wn;
+                cosc = arb_sin_cos_tab22[2 * p2[j] + 1] + ARB_SIN_COS_TAB2_LIMBS - wn;
+            }
+
+            if ((want_sin && !swapsincos) || (want_cos && swapsincos))
+            {
+                mpn_mul_n(ta, sinaj, cosc, wn);
+                mpn_mul_n(tb, cosaj, sinc, wn);
+                mpn_add_n(wj, ta + wn, tb + wn, wn);
+            }
+
+            if ((want_cos && !swapsincos) || (want_sin && swapsincos))
+            {
+                mpn_mul_n(ta, cosaj, cosc, wn);
+                mpn_mul_n(tb, sinaj, sinc, wn);
+                mpn_sub_n(ta, ta + wn, tb + wn, wn);
+            }
+
+            sinptr = wj;
+            cosptr = ta;
+
+            error[j] = 2 * error[j] + 2 * 1 + 3;
+        }
+        else        /* two table lookups, must be in table 2 */
+        {
+            mp_srcptr sinc, cosc, sind, cosd;
+
+            sinc = arb_sin_cos_tab21[2 * p1[j]] + ARB_SIN_COS_TAB2_LIMBS - wn;
+            cosc = arb_sin_cos_tab21[2 * p1[j] + 1] + ARB_SIN_COS_TAB2_LIMBS - wn;
+            sind = arb_sin_cos_tab22[2 * p2[j]] + ARB_SIN_COS_TAB2_LIMBS - wn;
+            cosd = arb_sin_cos_tab22[2 * p2[j] + 1] + ARB_SIN_COS_TAB2_LIMBS - wn;
+
+            mpn_mul_n(ta, sinc, cosd, wn);
+            mpn_mul_n(tb, cosc, sind, wn);
+            mpn_add_n(sinb, ta + wn, tb + wn, wn);
+
+            mpn_mul_n(ta, cosc, cosd, wn);
+            mpn_mul_n(tb, sinc, sind, wn);
+            mpn_sub_n(cosb, ta + wn, tb + wn, wn);
+
+            error2 = 2 * 1 + 2 * 1 + 3;
+
+            if ((want_sin && !swapsincos) || (want_cos && swapsincos))
+            {
+                mpn_mul_n(ta, sinaj, cosb, wn);
+                mpn_mul_n(tb, cosaj, sinb, wn);
+                mpn_add_n(wj, ta + wn, tb + wn, wn);
+            }
+
+            if ((want_cos && !swapsincos) || (want_sin && swapsincos))
+            {
+                mpn_mul_n(ta, cosaj, cosb, wn);
+                mpn_mul_n(tb, sinaj, sinb, wn);
+                mpn_sub_n(ta, ta + wn, tb + wn, wn);
+            }
+
+            error[j] = 2 * error[j] + 2 * error2 + 3;
+
+            sinptr = wj;
+            cosptr = ta;
+        }
+
+        if (swapsincos)
+        {
+            mp_ptr tmptr = sinptr;
+            sinptr = cosptr;
+            cosptr = tmptr;
+        }
+
+        if (want_sin)
+        {
+            mag_set_ui_2exp_si(arb_radref(s + i), error[j], -wprounded);
+            inexact = _arf_set_mpn_fixed(arb_midref(s + i), sinptr,
+                wn, wn, sinnegative, prec);
+            if (inexact)
+                arf_mag_add_ulp(arb_radref(s + i),
+                    arb_radref(s + i), arb_midref(s + i), prec);
+            mag_add(arb_radref(s + i), arb_radref(s + i), rad);
+        }
+
+        if (want_cos)
+        {
+            mag_set_ui_2exp_si(arb_radref(c + i), error[j], -wprounded);
+            inexact = _arf_set_mpn_fixed(arb_midref(c + i), cosptr,
+                wn, wn, cosnegative, prec);
+            if (inexact)
+                arf_mag_add_ulp(arb_radref(c + i),
+                    arb_radref(c + i), arb_midref(c + i), prec);
+            mag_add(arb_radref(c + i), arb_radref(c + i), rad);
+        }
+    }
+
+    mag_clear(rad);
+
+    TMP_END;
+}
+
+static void
+_arb_vec_sin_cos_basecase(arb_ptr s, arb_ptr c, arb_srcptr x,
+    slong len, slong prec)
+{
+    slong i, block, wn;
+
+    /* hardware doubles */
+    if (prec <= ARB_D_PREC)
+    {
+        for (i = 0; i < len; i++)
+            _arb_vec_sin_cos_one((s == NULL) ? NULL : s + i,
+                (c == NULL) ? NULL : c + i, x + i, prec);
+        return;
+    }
+
+    /* keep the powers of all reduced arguments in a block in cache */
+    wn = (prec + 8 + MAX_EXTRA_BITS + FLINT_BITS - 1) / FLINT_BITS;
+    block = FLINT_MAX(1, FLINT_MIN(64, 1024 / wn));
+
+    for (i = 0; i < len; i += block)
+        _arb_vec_sin_cos_block((s == NULL) ? NULL : s + i,
+            (c == NULL) ? NULL : c + i, x + i,
+            FLINT_MIN(block, len - i), prec);
+}
+
+typedef struct
+{
+    arb_ptr s;
+    arb_ptr c;
+    arb_srcptr x;
+    slong len;
+    slong prec;
+}
+vec_sin_cos_arg_t;
+
+static void *
+_arb_vec_sin_cos_worker(void * arg_ptr)
+{
+    vec_sin_cos_arg_t arg = *((vec_sin_cos_arg_t *) arg_ptr);
+
+    _arb_vec_sin_cos_basecase(arg.s, arg.c, arg.x, arg.len, arg.prec);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+_arb_vec_sin_cos(arb_ptr s, arb_ptr c, arb_srcptr x, slong len, slong prec)
+{
+    pthread_t * threads;
+    vec_sin_cos_arg_t * args;
+    slong i, num_threads;
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), len);
+
+    if (num_threads <= 1 || len * (prec + 64) < THREADED_CUTOFF)
+    {
+        _arb_vec_sin_cos_basecase(s, c, x, len, prec);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(vec_sin_cos_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        slong a = (len * i) / num_threads;
+        slong b = (len * (i + 1)) / num_threads;
+
+        args[i].s = (s == NULL) ? NULL : s + a;
+        args[i].c = (c == NULL) ? NULL : c + a;
+        args[i].x = x + a;
+        args[i].len = b - a;
+        args[i].prec = prec;
+
+        pthread_create(&threads[i], NULL, _arb_vec_sin_cos_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
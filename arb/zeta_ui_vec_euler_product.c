@@ -0,0 +1,248 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include <math.h>
+#include <pthread.h>
+#include "arb.h"
+
+/* see arb_zeta_ui_euler_product for the error bound: with all primes
+   p <= M included, the error in 1/zeta(s) is at most 4 M^(1-s) / (s-2) */
+static void
+add_error(arb_t z, ulong M, ulong s)
+{
+    mag_t t, u;
+    mag_init(t);
+    mag_init(u);
+    mag_set_ui(t, M);
+    mag_pow_ui_lower(t, t, s - 1);
+    mag_mul_ui_lower(t, t, s - 2);
+    mag_set_ui(u, 4);
+    mag_div(t, u, t);
+    mag_add(arb_radref(z), arb_radref(z), t);
+    mag_clear(t);
+    mag_clear(u);
+}
+
+typedef struct
+{
+    arb_ptr z;
+    const ulong * primes;
+    slong num_primes;
+    slong offset;
+    slong stride;
+    const ulong * cutoff;
+    ulong start;
+    slong num;
+    ulong step;
+    slong prec;
+}
+euler_arg_t;
+
+/* z[i] = prod (1 - p^(-s_i)) over the primes with index offset + k stride
+   and p <= cutoff[i], where s_i = start + i step */
+static void
+euler_product(euler_arg_t arg)
+{
+    arb_t t, u, v;
+    slong i, k, len, powprec;
+    ulong p, s;
+    double logp;
+
+    arb_init(t);
+    arb_init(u);
+    arb_init(v);
+
+    for (i = 0; i < arg.num; i++)
+        arb_one(arg.z + i);
+
+    for (k = arg.offset; k < arg.num_primes; k += arg.stride)
+    {
+        p = arg.primes[k];
+
+        /* the cutoffs decrease with s */
+        for (len = 0; len < arg.num && p <= arg.cutoff[len]; len++) ;
+
+        if (len == 0)
+            break;
+
+        logp = log(p) * 1.4426950408889634;
+
+        for (i = 0; i < len; i++)
+        {
+            s = arg.start + i * arg.step;
+            powprec = FLINT_MAX(arg.prec - s * logp, 8);
+
+            /* t = p^(-s), moving along the chain with u = p^(-step) */
+            if (i == 0)
+            {
+                arb_ui_pow_ui(t, p, s, powprec);
+                arb_inv(t, t, powprec);
+
+                if (len > 1)
+                {
+                    arb_ui_pow_ui(u, p, arg.step, powprec);
+                    arb_inv(u, u, powprec);
+                }
+            }
+            else
+            {
+                arb_mul(t, t, u, powprec);
+            }
+
+            arb_set_round(v, arg.z + i, powprec);
+            arb_mul(v, v, t, powprec);
+            arb_sub(arg.z + i, arg.z + i, v, arg.prec);
+        }
+    }
+
+    arb_clear(t);
+    arb_clear(u);
+    arb_clear(v);
+}
+
+static void *
+euler_product_worker(void * arg_ptr)
+{
+    euler_product(*((euler_arg_t *) arg_ptr));
+    flint_cleanup();
+    return NULL;
+}
+
+void
+arb_zeta_ui_vec_euler_product(arb_ptr z, ulong start, slong num,
+    ulong step, slong prec)
+{
+    pthread_t * threads;
+    euler_arg_t * args;
+    ulong * cutoff;
+    ulong * primes;
+    char * composite;
+    ulong s, p, m, pmax;
+    slong i, j, wp, num_primes, num_threads;
+    double a, b;
+
+    if (num < 1)
+        return;
+
+    if (start < 6)
+    {
+        flint_printf("too small s!\n");
+        abort();
+    }
+
+    /* heuristic, as for a single s, with extra bits for the chains */
+    wp = prec + FLINT_BIT_COUNT(prec) + (prec / start) + 4
+        + FLINT_BIT_COUNT(num);
+
+    /* include the primes p <= cutoff[i] for s_i, where p^(-s_i) is
+       below 2^(-prec) and the truncation error is small enough */
+    cutoff = flint_malloc(sizeof(ulong) * num);
+
+    for (i = 0; i < num; i++)
+    {
+        s = start + i * step;
+        a = ((prec + 1) * 0.69314718055995 + 2 - log(s - 2.)) / (s - 1.);
+        a = exp(a) + 1;
+        b = pow(2.0, (double) prec / s);
+        cutoff[i] = FLINT_MAX(a, b) + 1;
+    }
+
+    /* sieve all primes needed for the smallest s */
+    pmax = cutoff[0];
+    composite = flint_calloc(pmax + 1, sizeof(char));
+    num_primes = 0;
+    for (p = 2; p <= pmax; p++)
+    {
+        if (!composite[p])
+        {
+            num_primes++;
+            if (p <= pmax / p)
+                for (m = p * p; m <= pmax; m += p)
+                    composite[m] = 1;
+        }
+    }
+
+    primes = flint_malloc(sizeof(ulong) * num_primes);
+    for (p = 2, j = 0; p <= pmax; p++)
+        if (!composite[p])
+            primes[j++] = p;
+    flint_free(composite);
+
+    num_threads = flint_get_num_threads();
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, num_primes / 64));
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(euler_arg_t) * num_threads);
+
+    /* each thread takes every num_threads-th prime, which balances the
+       long chains of the small primes; the partial products are
+       multiplied together afterwards */
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].z = (i == 0) ? z : _arb_vec_init(num);
+        args[i].primes = primes;
+        args[i].num_primes = num_primes;
+        args[i].offset = i;
+        args[i].stride = num_threads;
+        args[i].cutoff = cutoff;
+        args[i].start = start;
+        args[i].num = num;
+        args[i].step = step;
+        args[i].prec = wp;
+    }
+
+    if (num_threads == 1)
+    {
+        euler_product(args[0]);
+    }
+    else
+    {
+        for (i = 0; i < num_threads; i++)
+            pthread_create(&threads[i], NULL, euler_product_worker, &args[i]);
+
+        for (i = 0; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        for (i = 1; i < num_threads; i++)
+        {
+            for (j = 0; j < num; j++)
+                arb_mul(z + j, z + j, args[i].z + j, wp);
+
+            _arb_vec_clear(args[i].z, num);
+        }
+    }
+
+    for (i = 0; i < num; i++)
+    {
+        add_error(z + i, cutoff[i], start + i * step);
+        arb_inv(z + i, z + i, prec);
+    }
+
+    flint_free(cutoff);
+    flint_free(primes);
+    flint_free(threads);
+    flint_free(args);
+}
+
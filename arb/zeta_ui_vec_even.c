@@ -23,14 +23,38 @@
 
 ******************************************************************************/
 
+#include "arith.h"
 #include "arb.h"
 
+/* the same choice as in arb_zeta_ui */
+static int
+use_euler_product(ulong n, slong prec)
+{
+    if (n < 6 || n > 0.7 * prec)
+        return 0;
+
+    if (prec < 10000)
+        return n >= 40 + 0.11 * prec;
+    else
+        return arith_bernoulli_number_size(n) * 0.9 >= prec;
+}
+
 void
 arb_zeta_ui_vec_even(arb_ptr x, ulong start, slong num, slong prec)
 {
-    slong i;
+    slong i, i0, i1;
+
+    /* the values computed with the Euler product form one range,
+       which is done in a single batch */
+    for (i0 = 0; i0 < num && !use_euler_product(start + 2 * i0, prec); i0++) ;
+    for (i1 = i0; i1 < num && use_euler_product(start + 2 * i1, prec); i1++) ;
+
+    for (i = 0; i < i0; i++)
+        arb_zeta_ui(x + i, start + 2 * i, prec);
+
+    arb_zeta_ui_vec_euler_product(x + i0, start + 2 * i0, i1 - i0, 2, prec);
 
-    for (i = 0; i < num; i++)
+    for (i = i1; i < num; i++)
         arb_zeta_ui(x + i, start + 2 * i, prec);
 }
 
@@ -23,12 +23,21 @@
 
 ******************************************************************************/
 
+#include <math.h>
 #include "arb.h"
 
+/* the same choice as in arb_zeta_ui, for n above the Borwein cutoff */
+static int
+use_euler_product(ulong n, slong prec)
+{
+    return n <= 0.7 * prec && n >= prec * 0.0006 &&
+        prec > 20 && n > 6 && n > 0.4 * pow(prec, 0.8);
+}
+
 void
 arb_zeta_ui_vec_odd(arb_ptr x, ulong start, slong num, slong prec)
 {
-    slong i, num_borwein;
+    slong i, i0, i1, num_borwein;
     ulong cutoff;
 
     cutoff = 40 + 0.3 * prec;
@@ -42,7 +51,18 @@ arb_zeta_ui_vec_odd(arb_ptr x, ulong start, slong num, slong prec)
         num_borwein = 0;
 
     arb_zeta_ui_vec_borwein(x, start, num_borwein, 2, prec);
-    for (i = num_borwein; i < num; i++)
+
+    /* the values computed with the Euler product form one range,
+       which is done in a single batch */
+    for (i0 = num_borwein; i0 < num && !use_euler_product(start + 2 * i0, prec); i0++) ;
+    for (i1 = i0; i1 < num && use_euler_product(start + 2 * i1, prec); i1++) ;
+
+    for (i = num_borwein; i < i0; i++)
+        arb_zeta_ui(x + i, start + 2 * i, prec);
+
+    arb_zeta_ui_vec_euler_product(x + i0, start + 2 * i0, i1 - i0, 2, prec);
+
+    for (i = i1; i < num; i++)
         arb_zeta_ui(x + i, start + 2 * i, prec);
 }
 
@@ -131,6 +131,12 @@ slong arb_calc_isolate_roots(arf_interval_ptr * blocks, int ** flags,
     const arf_interval_t block, slong maxdepth, slong maxeval, slong maxfound,
     slong prec);
 
+/* polynomials */
+
+slong arb_calc_isolate_roots_poly(arf_interval_ptr * blocks, int ** flags,
+    const arb_poly_t poly, const arf_interval_t block,
+    slong maxdepth, slong maxeval, slong maxfound, slong prec);
+
 int arb_calc_refine_root_bisect(arf_interval_t r, arb_calc_func_t func,
     void * param, const arf_interval_t start, slong iter, slong prec);
 
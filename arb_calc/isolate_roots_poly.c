@@ -0,0 +1,474 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+
+#include <pthread.h>
+#include "arb_calc.h"
+
+#define BLOCK_NO_ZERO 0
+#define BLOCK_ISOLATED_ZERO 1
+#define BLOCK_UNKNOWN 2
+
+typedef struct
+{
+    arf_interval_ptr blocks;
+    int * flags;
+    slong length;
+    slong alloc;
+}
+block_list_struct;
+
+typedef struct
+{
+    slong eval_count;
+    slong found_count;
+    pthread_mutex_t * mutex;
+}
+budget_struct;
+
+static void
+add_block(block_list_struct * out, const arf_interval_t block, int status)
+{
+    if (out->length >= out->alloc)
+    {
+        slong new_alloc;
+        new_alloc = (out->alloc == 0) ? 1 : 2 * out->alloc;
+        out->blocks = flint_realloc(out->blocks,
+            sizeof(arf_interval_struct) * new_alloc);
+        out->flags = flint_realloc(out->flags, sizeof(int) * new_alloc);
+        out->alloc = new_alloc;
+    }
+
+    arf_interval_init(out->blocks + out->length);
+    arf_interval_set(out->blocks + out->length, block);
+    out->flags[out->length] = status;
+    out->length++;
+}
+
+/* returns 1 and uses up one evaluation if the budget allows it */
+static int
+budget_take_eval(budget_struct * budget)
+{
+    int result;
+
+    if (budget->mutex != NULL)
+        pthread_mutex_lock(budget->mutex);
+
+    result = (budget->eval_count > 0 && budget->found_count > 0);
+    if (result)
+        budget->eval_count--;
+
+    if (budget->mutex != NULL)
+        pthread_mutex_unlock(budget->mutex);
+
+    return result;
+}
+
+static void
+budget_found(budget_struct * budget)
+{
+    if (budget->mutex != NULL)
+        pthread_mutex_lock(budget->mutex);
+
+    budget->found_count--;
+
+    if (budget->mutex != NULL)
+        pthread_mutex_unlock(budget->mutex);
+}
+
+/* Computes lower and upper bounds for the number of sign changes in the
+   coefficients of v, where coefficients that contain zero without being
+   exactly zero can have either sign (or be zero). */
+static void
+_sign_changes_bounds(slong * vmin, slong * vmax, arb_srcptr v, slong len)
+{
+    /* lo[s], hi[s]: fewest and most sign changes so far, given that the
+       last nonzero coefficient has sign s (0: none yet, 1: +, 2: -);
+       -1 marks an impossible state */
+    slong lo[3], hi[3], nlo[3], nhi[3];
+    slong i, s, t;
+    int may_pos, may_neg, may_zero;
+
+    lo[0] = hi[0] = 0;
+    lo[1] = hi[1] = lo[2] = hi[2] = -1;
+
+    for (i = 0; i < len; i++)
+    {
+        if (arb_is_zero(v + i))
+            continue;
+
+        may_pos = !arb_is_nonpositive(v + i);
+        may_neg = !arb_is_nonnegative(v + i);
+        may_zero = arb_contains_zero(v + i);
+
+        for (t = 0; t < 3; t++)
+        {
+            nlo[t] = may_zero ? lo[t] : -1;
+            nhi[t] = may_zero ? hi[t] : -1;
+        }
+
+        for (t = 1; t <= 2; t++)
+        {
+            if ((t == 1 && !may_pos) || (t == 2 && !may_neg))
+                continue;
+
+            for (s = 0; s < 3; s++)
+            {
+                slong c;
+
+                if (hi[s] < 0)
+                    continue;
+
+                c = (s != 0 && s != t);
+
+                if (nlo[t] < 0 || lo[s] + c < nlo[t])
+                    nlo[t] = lo[s] + c;
+                if (nhi[t] < 0 || hi[s] + c > nhi[t])
+                    nhi[t] = hi[s] + c;
+            }
+        }
+
+        for (t = 0; t < 3; t++)
+        {
+            lo[t] = nlo[t];
+            hi[t] = nhi[t];
+        }
+    }
+
+    *vmin = WORD_MAX;
+    *vmax = 0;
+
+    for (t = 0; t < 3; t++)
+    {
+        if (hi[t] >= 0)
+        {
+            *vmin = FLINT_MIN(*vmin, lo[t]);
+            *vmax = FLINT_MAX(*vmax, hi[t]);
+        }
+    }
+}
+
+/* Given q(x) = p(a + (b-a) x), uses Descartes' rule of signs to
+   determine the number of roots of p on [a, b]. */
+static int
+check_block_poly(arb_srcptr q, slong len, slong prec)
+{
+    arb_ptr t;
+    arb_t one;
+    slong vmin, vmax;
+    int result;
+
+    t = _arb_vec_init(len);
+    arb_init(one);
+    arb_one(one);
+
+    /* t(x) = (x+1)^n q(1/(x+1)); the roots of q on (0, 1) correspond
+       to the positive roots of t */
+    _arb_poly_reverse(t, q, len, len);
+    _arb_poly_taylor_shift(t, one, len, prec);
+
+    result = BLOCK_UNKNOWN;
+
+    /* t(0) = p(b) and the leading coefficient is p(a); Descartes' rule
+       says nothing about roots at the endpoints */
+    if (!arb_contains_zero(t) && !arb_contains_zero(t + len - 1))
+    {
+        _sign_changes_bounds(&vmin, &vmax, t, len);
+
+        if (vmax == 0)
+            result = BLOCK_NO_ZERO;
+        else if (vmin == 1 && vmax == 1)
+            result = BLOCK_ISOLATED_ZERO;
+    }
+
+    _arb_vec_clear(t, len);
+    arb_clear(one);
+
+    return result;
+}
+
+static void
+isolate_roots_poly_recursive(block_list_struct * out, budget_struct * budget,
+    arb_srcptr q, slong len, const arf_interval_t block,
+    slong depth, slong prec)
+{
+    int status;
+
+    if (!budget_take_eval(budget))
+    {
+        status = BLOCK_UNKNOWN;
+        add_block(out, block, status);
+        return;
+    }
+
+    status = check_block_poly(q, len, prec);
+
+    if (status == BLOCK_NO_ZERO)
+        return;
+
+    if (status == BLOCK_ISOLATED_ZERO || depth <= 0)
+    {
+        if (status == BLOCK_ISOLATED_ZERO)
+        {
+            if (arb_calc_verbose)
+            {
+                flint_printf("found isolated root in: ");
+                arf_interval_printd(block, 15);
+                flint_printf("\n");
+            }
+
+            budget_found(budget);
+        }
+
+        add_block(out, block, status);
+    }
+    else
+    {
+        arf_interval_t L, R;
+        arb_ptr qL, qR;
+        arb_t one;
+        slong k;
+
+        arf_interval_init(L);
+        arf_interval_init(R);
+        qL = _arb_vec_init(len);
+        qR = _arb_vec_init(len);
+        arb_init(one);
+        arb_one(one);
+
+        arf_set(&L->a, &block->a);
+        arf_add(&L->b, &block->a, &block->b, ARF_PREC_EXACT, ARF_RND_DOWN);
+        arf_mul_2exp_si(&L->b, &L->b, -1);
+        arf_set(&R->a, &L->b);
+        arf_set(&R->b, &block->b);
+
+        /* qL(x) = q(x/2), qR(x) = q((x+1)/2) */
+        for (k = 0; k < len; k++)
+            arb_mul_2exp_si(qL + k, q + k, -k);
+
+        _arb_vec_set(qR, qL, len);
+        _arb_poly_taylor_shift(qR, one, len, prec);
+
+        isolate_roots_poly_recursive(out, budget, qL, len, L, depth - 1, prec);
+        isolate_roots_poly_recursive(out, budget, qR, len, R, depth - 1, prec);
+
+        arf_interval_clear(L);
+        arf_interval_clear(R);
+        _arb_vec_clear(qL, len);
+        _arb_vec_clear(qR, len);
+        arb_clear(one);
+    }
+}
+
+typedef struct
+{
+    block_list_struct * out;
+    budget_struct * budget;
+    arb_srcptr q;
+    arf_interval_srcptr pieces;
+    slong len;
+    slong start;
+    slong stop;
+    slong step;
+    slong depth;
+    slong prec;
+}
+isolate_arg_t;
+
+static void *
+isolate_roots_poly_thread(void * arg_ptr)
+{
+    isolate_arg_t arg = *((isolate_arg_t *) arg_ptr);
+    slong i;
+
+    for (i = arg.start; i < arg.stop; i += arg.step)
+    {
+        isolate_roots_poly_recursive(arg.out + i, arg.budget,
+            arg.q + i * arg.len, arg.len, arg.pieces + i, arg.depth, arg.prec);
+    }
+
+    flint_cleanup();
+    return NULL;
+}
+
+slong
+arb_calc_isolate_roots_poly(arf_interval_ptr * blocks, int ** flags,
+    const arb_poly_t poly, const arf_interval_t block,
+    slong maxdepth, slong maxeval, slong maxfound, slong prec)
+{
+    block_list_struct out;
+    budget_struct budget;
+    arb_ptr q;
+    arb_t t, w;
+    slong k, len, num_threads, split;
+
+    len = poly->length;
+
+    out.blocks = NULL;
+    out.flags = NULL;
+    out.length = 0;
+    out.alloc = 0;
+
+    budget.eval_count = maxeval;
+    budget.found_count = maxfound;
+    budget.mutex = NULL;
+
+    if (len == 0)
+    {
+        add_block(&out, block, BLOCK_UNKNOWN);
+        *blocks = out.blocks;
+        *flags = out.flags;
+        return out.length;
+    }
+
+    q = _arb_vec_init(len);
+    arb_init(t);
+    arb_init(w);
+
+    /* q(x) = p(a + (b-a) x); the width of the block is computed exactly
+       so that the subintervals are the ones described by q */
+    _arb_vec_set(q, poly->coeffs, len);
+    arb_set_arf(t, &block->a);
+    _arb_poly_taylor_shift(q, t, len, prec);
+
+    arf_sub(arb_midref(w), &block->b, &block->a, ARF_PREC_EXACT, ARF_RND_DOWN);
+    arb_one(t);
+    for (k = 1; k < len; k++)
+    {
+        arb_mul(t, t, w, prec);
+        arb_mul(q + k, q + k, t, prec);
+    }
+
+    num_threads = flint_get_num_threads();
+
+    /* split the block into 2^split pieces which are processed in parallel */
+    split = 0;
+    if (num_threads > 1)
+    {
+        while ((WORD(1) << split) < num_threads && split < maxdepth)
+            split++;
+    }
+
+    if (split == 0)
+    {
+        isolate_roots_poly_recursive(&out, &budget, q, len, block,
+            maxdepth, prec);
+    }
+    else
+    {
+        pthread_t * threads;
+        pthread_mutex_t mutex;
+        isolate_arg_t * args;
+        block_list_struct * outs;
+        arf_interval_ptr pieces;
+        arb_ptr qs;
+        slong i, j, num_pieces;
+
+        num_pieces = WORD(1) << split;
+        num_threads = FLINT_MIN(num_threads, num_pieces);
+
+        pieces = _arf_interval_vec_init(num_pieces);
+        qs = _arb_vec_init(num_pieces * len);
+        outs = flint_malloc(sizeof(block_list_struct) * num_pieces);
+
+        /* piece i is a + (b-a) [i, i+1] / 2^split, on which
+           p is given by q((x+i) / 2^split) */
+        for (i = 0; i < num_pieces; i++)
+        {
+            arf_sub(&pieces[i].a, &block->b, &block->a, ARF_PREC_EXACT, ARF_RND_DOWN);
+            arf_mul_si(&pieces[i].b, &pieces[i].a, i + 1, ARF_PREC_EXACT, ARF_RND_DOWN);
+            arf_mul_si(&pieces[i].a, &pieces[i].a, i, ARF_PREC_EXACT, ARF_RND_DOWN);
+            arf_mul_2exp_si(&pieces[i].a, &pieces[i].a, -split);
+            arf_mul_2exp_si(&pieces[i].b, &pieces[i].b, -split);
+            arf_add(&pieces[i].a, &pieces[i].a, &block->a, ARF_PREC_EXACT, ARF_RND_DOWN);
+            arf_add(&pieces[i].b, &pieces[i].b, &block->a, ARF_PREC_EXACT, ARF_RND_DOWN);
+
+            for (k = 0; k < len; k++)
+                arb_mul_2exp_si(qs + i * len + k, q + k, -k * split);
+
+            arb_set_si(t, i);
+            _arb_poly_taylor_shift(qs + i * len, t, len, prec);
+
+            outs[i].blocks = NULL;
+            outs[i].flags = NULL;
+            outs[i].length = 0;
+            outs[i].alloc = 0;
+        }
+
+        pthread_mutex_init(&mutex, NULL);
+        budget.mutex = &mutex;
+
+        threads = flint_malloc(sizeof(pthread_t) * num_threads);
+        args = flint_malloc(sizeof(isolate_arg_t) * num_threads);
+
+        for (i = 0; i < num_threads; i++)
+        {
+            args[i].out = outs;
+            args[i].budget = &budget;
+            args[i].q = qs;
+            args[i].pieces = pieces;
+            args[i].len = len;
+            args[i].start = i;
+            args[i].stop = num_pieces;
+            args[i].step = num_threads;
+            args[i].depth = maxdepth - split;
+            args[i].prec = prec;
+            pthread_create(&threads[i], NULL, isolate_roots_poly_thread, &args[i]);
+        }
+
+        for (i = 0; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        pthread_mutex_destroy(&mutex);
+
+        /* concatenate the output for the pieces, in order */
+        for (i = 0; i < num_pieces; i++)
+        {
+            for (j = 0; j < outs[i].length; j++)
+            {
+                add_block(&out, outs[i].blocks + j, outs[i].flags[j]);
+                arf_interval_clear(outs[i].blocks + j);
+            }
+
+            flint_free(outs[i].blocks);
+            flint_free(outs[i].flags);
+        }
+
+        _arf_interval_vec_clear(pieces, num_pieces);
+        _arb_vec_clear(qs, num_pieces * len);
+        flint_free(outs);
+        flint_free(threads);
+        flint_free(args);
+    }
+
+    _arb_vec_clear(q, len);
+    arb_clear(t);
+    arb_clear(w);
+
+    *blocks = flint_realloc(out.blocks, out.length * sizeof(arf_interval_struct));
+    *flags = flint_realloc(out.flags, out.length * sizeof(int));
+
+    return out.length;
+}
@@ -0,0 +1,168 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+
+#include "arb_calc.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("isolate_roots_poly....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000; iter++)
+    {
+        slong a, b, maxdepth, maxeval, maxfound, prec, i, j, num, deg, count;
+        slong roots[20];
+        arf_interval_ptr blocks;
+        int * info;
+        arf_interval_t interval;
+        arb_poly_t p, f;
+        arb_t t;
+
+        prec = 2 + n_randint(state, 200);
+
+        a = (slong) n_randint(state, 41) - 20;
+        b = a + 1 + n_randint(state, 40);
+
+        maxdepth = 1 + n_randint(state, 60);
+        maxeval = 1 + n_randint(state, 5000);
+        maxfound = 1 + n_randint(state, 20);
+
+        arf_interval_init(interval);
+        arb_poly_init(p);
+        arb_poly_init(f);
+        arb_init(t);
+
+        arf_set_si(&interval->a, a);
+        arf_set_si(&interval->b, b);
+
+        /* product of (x - r) for distinct integers r */
+        deg = n_randint(state, 12);
+        arb_poly_one(p);
+        for (i = 0; i < deg; i++)
+        {
+            do {
+                roots[i] = (slong) n_randint(state, 51) - 25;
+                for (j = 0; j < i; j++)
+                    if (roots[i] == roots[j])
+                        break;
+            } while (j < i);
+
+            arb_poly_set_coeff_si(f, 1, 1);
+            arb_poly_set_coeff_si(f, 0, -roots[i]);
+            arb_poly_mul(p, p, f, prec);
+        }
+
+        /* possibly multiply by x^2 + 1, which has no real roots */
+        if (n_randint(state, 2))
+        {
+            arb_poly_zero(f);
+            arb_poly_set_coeff_si(f, 2, 1);
+            arb_poly_set_coeff_si(f, 0, 1);
+            arb_poly_mul(p, p, f, prec);
+        }
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        num = arb_calc_isolate_roots_poly(&blocks, &info, p,
+            interval, maxdepth, maxeval, maxfound, prec);
+
+        flint_set_num_threads(1);
+
+        /* check that all roots are accounted for */
+        for (i = 0; i < deg; i++)
+        {
+            if (roots[i] >= a && roots[i] <= b)
+            {
+                int found = 0;
+
+                for (j = 0; j < num; j++)
+                {
+                    arf_interval_get_arb(t, blocks + j, ARF_PREC_EXACT);
+
+                    if (arb_contains_si(t, roots[i]))
+                    {
+                        found = 1;
+                        break;
+                    }
+                }
+
+                if (!found)
+                {
+                    flint_printf("FAIL: missing root %wd\n", roots[i]);
+                    flint_printf("a = %wd, b = %wd, maxdepth = %wd, maxeval = %wd, maxfound = %wd, prec = %wd\n",
+                        a, b, maxdepth, maxeval, maxfound, prec);
+                    abort();
+                }
+            }
+        }
+
+        /* check that all reported single roots are good */
+        for (i = 0; i < num; i++)
+        {
+            if (info[i] == 1)
+            {
+                arf_interval_get_arb(t, blocks + i, ARF_PREC_EXACT);
+
+                count = 0;
+                for (j = 0; j < deg; j++)
+                    count += arb_contains_si(t, roots[j]);
+
+                if (count != 1)
+                {
+                    flint_printf("FAIL: bad root %wd\n", i);
+                    flint_printf("a = %wd, b = %wd, maxdepth = %wd, maxeval = %wd, maxfound = %wd, prec = %wd\n",
+                        a, b, maxdepth, maxeval, maxfound, prec);
+
+                    for (j = 0; j < num; j++)
+                    {
+                        arf_interval_printd(blocks + j, 15);
+                        flint_printf("   %d \n", info[j]);
+                    }
+
+                    abort();
+                }
+            }
+        }
+
+        _arf_interval_vec_clear(blocks, num);
+        flint_free(info);
+
+        arf_interval_clear(interval);
+        arb_poly_clear(p);
+        arb_poly_clear(f);
+        arb_clear(t);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -324,6 +324,26 @@ void _arb_poly_compose_divconquer(arb_ptr res,
 void arb_poly_compose_divconquer(arb_poly_t res,
               const arb_poly_t poly1, const arb_poly_t poly2, slong prec);
 
+void _arb_poly_taylor_shift_horner(arb_ptr poly, const arb_t c, slong n, slong prec);
+
+void arb_poly_taylor_shift_horner(arb_poly_t g, const arb_poly_t f,
+    const arb_t c, slong prec);
+
+void _arb_poly_taylor_shift_divconquer(arb_ptr poly, const arb_t c, slong n, slong prec);
+
+void arb_poly_taylor_shift_divconquer(arb_poly_t g, const arb_poly_t f,
+    const arb_t c, slong prec);
+
+void _arb_poly_taylor_shift_convolution(arb_ptr poly, const arb_t c, slong n, slong prec);
+
+void arb_poly_taylor_shift_convolution(arb_poly_t g, const arb_poly_t f,
+    const arb_t c, slong prec);
+
+void _arb_poly_taylor_shift(arb_ptr poly, const arb_t c, slong n, slong prec);
+
+void arb_poly_taylor_shift(arb_poly_t g, const arb_poly_t f,
+    const arb_t c, slong prec);
+
 void _arb_poly_compose_series_horner(arb_ptr res, arb_srcptr poly1, slong len1,
                             arb_srcptr poly2, slong len2, slong n, slong prec);
 
@@ -608,6 +628,18 @@ void arb_poly_riemann_siegel_theta_series(arb_poly_t res, const arb_poly_t h, sl
 void _arb_poly_riemann_siegel_z_series(arb_ptr res, arb_srcptr h, slong hlen, slong len, slong prec);
 void arb_poly_riemann_siegel_z_series(arb_poly_t res, const arb_poly_t h, slong n, slong prec);
 
+#define ARB_POLY_RS_MAX_K 4
+
+slong _arb_poly_riemann_siegel_rs_psi_len(slong prec);
+void _arb_poly_riemann_siegel_rs_psi_tab(arb_ptr tab, slong L, slong prec);
+int _arb_poly_riemann_siegel_rs_N(ulong * N, const arb_t t);
+void _arb_poly_riemann_siegel_rs_remainder(arb_t res, const arb_t t, ulong N,
+    arb_srcptr tab, slong L, slong prec);
+
+void arb_poly_riemann_siegel_z_rs(arb_t res, const arb_t t, slong prec);
+void arb_poly_riemann_siegel_z_rs_vec(arb_ptr res, const arb_t t0,
+    const arb_t h, slong num, slong prec);
+
 slong _arb_poly_swinnerton_dyer_ui_prec(ulong n);
 void _arb_poly_swinnerton_dyer_ui(arb_ptr T, ulong n, slong trunc, slong prec);
 void arb_poly_swinnerton_dyer_ui(arb_poly_t poly, ulong n, slong prec);
@@ -23,17 +23,68 @@
 
 ******************************************************************************/
 
+#include <pthread.h>
 #include "arb_poly.h"
 
 /* pointer to (x/Q)^i */
 #define Ri(ii) (R + (n-1)*((ii)-1))
 
+/* use threads for n at least this large */
+#define THREADED_CUTOFF 100
+
+typedef struct
+{
+    arb_ptr Qinv;
+    arb_srcptr S;
+    arb_srcptr R;
+    slong i;
+    slong j0;
+    slong j1;
+    slong n;
+    slong prec;
+}
+revert_arg_t;
+
+/* Qinv[i+j] = [x^(i+j-1)] S (x/Q)^j / (i+j) for j0 <= j < j1 */
+static void
+_revert_dot_products(arb_ptr Qinv, arb_srcptr S, arb_srcptr R,
+    slong i, slong j0, slong j1, slong n, slong prec)
+{
+    slong j, k;
+    arb_t t;
+
+    arb_init(t);
+
+    for (j = j0; j < j1 && i + j < n; j++)
+    {
+        arb_mul(t, S + 0, Ri(j) + i + j - 1, prec);
+        for (k = 1; k <= i + j - 1; k++)
+            arb_addmul(t, S + k, Ri(j) + i + j - 1 - k, prec);
+        arb_div_ui(Qinv + i + j, t, i + j, prec);
+    }
+
+    arb_clear(t);
+}
+
+static void *
+_revert_worker(void * arg_ptr)
+{
+    revert_arg_t arg = *((revert_arg_t *) arg_ptr);
+
+    _revert_dot_products(arg.Qinv, arg.S, arg.R, arg.i, arg.j0, arg.j1,
+        arg.n, arg.prec);
+
+    flint_cleanup();
+    return NULL;
+}
+
 void
 _arb_poly_revert_series_lagrange_fast(arb_ptr Qinv, arb_srcptr Q, slong Qlen, slong n, slong prec)
 {
-    slong i, j, k, m;
+    slong i, j, m, num_threads;
     arb_ptr R, S, T, tmp;
-    arb_t t;
+    pthread_t * threads;
+    revert_arg_t * args;
 
     if (n <= 2)
     {
@@ -46,7 +97,13 @@ _arb_poly_revert_series_lagrange_fast(arb_ptr Qinv, arb_srcptr Q, slong Qlen, sl
 
     m = n_sqrt(n);
 
-    arb_init(t);
+    num_threads = 1;
+    if (n >= THREADED_CUTOFF)
+        num_threads = FLINT_MIN(flint_get_num_threads(), m - 1);
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(revert_arg_t) * num_threads);
+
     R = _arb_vec_init((n - 1) * m);
     S = _arb_vec_init(n - 1);
     T = _arb_vec_init(n - 1);
@@ -67,12 +124,28 @@ _arb_poly_revert_series_lagrange_fast(arb_ptr Qinv, arb_srcptr Q, slong Qlen, sl
     {
         arb_div_ui(Qinv + i, S + i - 1, i, prec);
 
-        for (j = 1; j < m && i + j < n; j++)
+        /* the dot products for different j are independent */
+        if (num_threads > 1)
         {
-            arb_mul(t, S + 0, Ri(j) + i + j - 1, prec);
-            for (k = 1; k <= i + j - 1; k++)
-                arb_addmul(t, S + k, Ri(j) + i + j - 1 - k, prec);
-            arb_div_ui(Qinv + i + j, t, i + j, prec);
+            for (j = 0; j < num_threads; j++)
+            {
+                args[j].Qinv = Qinv;
+                args[j].S = S;
+                args[j].R = R;
+                args[j].i = i;
+                args[j].j0 = 1 + ((m - 1) * j) / num_threads;
+                args[j].j1 = 1 + ((m - 1) * (j + 1)) / num_threads;
+                args[j].n = n;
+                args[j].prec = prec;
+                pthread_create(&threads[j], NULL, _revert_worker, &args[j]);
+            }
+
+            for (j = 0; j < num_threads; j++)
+                pthread_join(threads[j], NULL);
+        }
+        else
+        {
+            _revert_dot_products(Qinv, S, R, i, 1, m, n, prec);
         }
 
         if (i + 1 < n)
@@ -82,7 +155,8 @@ _arb_poly_revert_series_lagrange_fast(arb_ptr Qinv, arb_srcptr Q, slong Qlen, sl
         }
     }
 
-    arb_clear(t);
+    flint_free(threads);
+    flint_free(args);
     _arb_vec_clear(R, (n - 1) * m);
     _arb_vec_clear(S, n - 1);
     _arb_vec_clear(T, n - 1);
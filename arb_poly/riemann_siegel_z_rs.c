@@ -0,0 +1,398 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb_poly.h"
+
+/* Gabcke's constants: for t >= 200, the error of the Riemann-Siegel
+   formula with the correction terms C_0, ..., C_K included is bounded
+   by d_K t^(-(2K+3)/4) */
+static const double rs_gabcke_d[ARB_POLY_RS_MAX_K + 1] =
+    { 0.127, 0.053, 0.011, 0.031, 0.017 };
+
+/* Taylor coefficients of Psi at 0 and 1/2 are bounded by this
+   (max |Psi(z)| on the circles of radius 1, which is about 536 and 10) */
+#define PSI_COEFF_BOUND 1024
+
+slong
+_arb_poly_riemann_siegel_rs_psi_len(slong prec)
+{
+    slong L;
+
+    /* shifting by |x| <= 5/16, the terms of order >= L contribute at most
+       8 * 1024 * L^12 * (5/16)^(L-12) to each of the first 13 coefficients */
+    for (L = 16; ; L++)
+    {
+        if (13.0 + 12.0 * log(L) * 1.4426950408889634
+            - 1.678 * (L - 12) < -prec)
+            return L;
+    }
+}
+
+/* Psi(x) = cos(2 pi (x^2 - x - 1/16)) / cos(2 pi x) expanded at x = 0
+   (in tab[0, L)) and x = 1/2 (in tab[L, 2L)); the denominators have
+   constant term +/- 1, so the removable singularities at x = 1/4 and
+   x = 3/4 do not affect the series division */
+void
+_arb_poly_riemann_siegel_rs_psi_tab(arb_ptr tab, slong L, slong prec)
+{
+    arb_ptr h, s, c, den;
+
+    h = _arb_vec_init(3);
+    s = _arb_vec_init(L);
+    c = _arb_vec_init(L);
+    den = _arb_vec_init(L);
+
+    /* den = cos(2 pi x) */
+    arb_zero(h);
+    arb_set_ui(h + 1, 2);
+    _arb_poly_sin_cos_pi_series(s, den, h, 2, L, prec);
+
+    /* center 0: cos(pi (2x^2 - 2x - 1/8)) */
+    arb_set_si(h, -1);
+    arb_mul_2exp_si(h, h, -3);
+    arb_set_si(h + 1, -2);
+    arb_set_ui(h + 2, 2);
+    _arb_poly_sin_cos_pi_series(s, c, h, 3, L, prec);
+    _arb_poly_div_series(tab, c, L, den, L, L, prec);
+
+    /* center 1/2: -cos(pi (2x^2 - 5/8)) */
+    arb_set_si(h, -5);
+    arb_mul_2exp_si(h, h, -3);
+    arb_zero(h + 1);
+    _arb_poly_sin_cos_pi_series(s, c, h, 3, L, prec);
+    _arb_vec_neg(c, c, L);
+    _arb_poly_div_series(tab + L, c, L, den, L, L, prec);
+
+    _arb_vec_clear(h, 3);
+    _arb_vec_clear(s, L);
+    _arb_vec_clear(c, L);
+    _arb_vec_clear(den, L);
+}
+
+/* D[j] = Psi^(j)(p) for 0 <= j <= 12 and 0 <= p <= 1 */
+static void
+rs_psi_derivatives(arb_ptr D, const arb_t p, arb_srcptr tab, slong L,
+    slong prec)
+{
+    arb_ptr b;
+    arb_t x;
+    mag_t err, r;
+    int reflect;
+    slong i, j;
+
+    b = _arb_vec_init(L);
+    arb_init(x);
+    mag_init(err);
+    mag_init(r);
+
+    /* Psi(1 - p) = Psi(p) */
+    reflect = arf_cmp_2exp_si(arb_midref(p), -1) > 0;
+
+    if (reflect)
+        arb_sub_ui(x, p, 1, prec);
+    else
+        arb_set(x, p);
+    arb_abs(x, x);
+
+    /* shift from the nearest of the centers 0 and 1/2 */
+    if (arf_cmp_2exp_si(arb_midref(x), -2) > 0)
+    {
+        arb_mul_2exp_si(x, x, 1);
+        arb_sub_ui(x, x, 1, prec);
+        arb_mul_2exp_si(x, x, -1);
+        _arb_vec_set(b, tab + L, L);
+    }
+    else
+    {
+        _arb_vec_set(b, tab, L);
+    }
+
+    arb_get_mag(r, x);
+    mag_set_ui(err, 5);
+    mag_mul_2exp_si(err, err, -4);
+
+    if (mag_cmp(r, err) > 0)
+    {
+        for (j = 0; j <= 12; j++)
+            arb_indeterminate(D + j);
+    }
+    else
+    {
+        /* Taylor shift, computing only the first 13 coefficients */
+        for (i = 0; i <= 12; i++)
+            for (j = L - 2; j >= i; j--)
+                arb_addmul(b + j, b + j + 1, x, prec);
+
+        mag_set_ui(err, L);
+        mag_pow_ui(err, err, 12);
+        mag_mul_ui(err, err, 8 * PSI_COEFF_BOUND);
+        mag_set_ui(r, 5);
+        mag_mul_2exp_si(r, r, -4);
+        mag_pow_ui(r, r, L - 12);
+        mag_mul(err, err, r);
+
+        for (j = 0; j <= 12; j++)
+        {
+            arb_add_error_mag(b + j, err);
+            arb_fac_ui(x, j, prec);
+            arb_mul(D + j, b + j, x, prec);
+
+            if (reflect && (j % 2 == 1))
+                arb_neg(D + j, D + j);
+        }
+    }
+
+    _arb_vec_clear(b, L);
+    arb_clear(x);
+    mag_clear(err);
+    mag_clear(r);
+}
+
+int
+_arb_poly_riemann_siegel_rs_N(ulong * N, const arb_t t)
+{
+    arb_t a;
+    fmpz_t f;
+    slong prec;
+    int success;
+
+    arb_init(a);
+    fmpz_init(f);
+
+    arb_set_ui(a, 200);
+    success = arb_is_finite(t) && arb_ge(t, a);
+
+    if (success)
+    {
+        prec = 64 + FLINT_MAX(0, arf_abs_bound_lt_2exp_si(arb_midref(t)));
+
+        /* a = sqrt(t / (2 pi)) */
+        arb_const_pi(a, prec);
+        arb_mul_2exp_si(a, a, 1);
+        arb_div(a, t, a, prec);
+        arb_sqrt(a, a, prec);
+        arb_floor(a, a, prec);
+
+        success = arb_get_unique_fmpz(f, a) && fmpz_abs_fits_ui(f);
+
+        if (success)
+            *N = fmpz_get_ui(f);
+    }
+
+    arb_clear(a);
+    fmpz_clear(f);
+
+    return success;
+}
+
+void
+_arb_poly_riemann_siegel_rs_remainder(arb_t res, const arb_t t, ulong N,
+    arb_srcptr tab, slong L, slong prec)
+{
+    arb_t a, p, u, pi2, x;
+    arb_ptr D, C;
+    mag_t err, d;
+    slong K, k;
+    double logt;
+
+    arb_init(a);
+    arb_init(p);
+    arb_init(u);
+    arb_init(pi2);
+    arb_init(x);
+    D = _arb_vec_init(13);
+    C = _arb_vec_init(ARB_POLY_RS_MAX_K + 1);
+    mag_init(err);
+    mag_init(d);
+
+    /* smallest K for which Gabcke's bound is below 2^-prec */
+    logt = arf_get_d(arb_midref(t), ARF_RND_DOWN);
+    logt = log(logt) * 1.4426950408889634;
+    for (K = 0; K < ARB_POLY_RS_MAX_K; K++)
+        if (log(rs_gabcke_d[K]) * 1.4426950408889634
+            - (2 * K + 3) * 0.25 * logt < -prec)
+            break;
+
+    /* err = d_K t^(-(2K+3)/4), evaluated at a lower bound for t */
+    arb_get_mag_lower(err, t);
+    arf_set_mag(arb_midref(u), err);
+    mag_zero(arb_radref(u));
+    arb_root(u, u, 4, MAG_BITS);
+    arb_pow_ui(u, u, 2 * K + 3, MAG_BITS);
+    arb_inv(u, u, MAG_BITS);
+    arb_get_mag(err, u);
+    mag_set_d(d, rs_gabcke_d[K]);
+    mag_mul(err, err, d);
+
+    /* a = sqrt(t / (2 pi)), p = a - N */
+    arb_const_pi(pi2, prec);
+    arb_mul_2exp_si(a, pi2, 1);
+    arb_div(a, t, a, prec);
+    arb_sqrt(a, a, prec);
+    arb_sub_ui(p, a, N, prec);
+    arb_mul(pi2, pi2, pi2, prec);
+
+    rs_psi_derivatives(D, p, tab, L, prec);
+
+    /* C_0 = Psi */
+    arb_set(C, D);
+
+    /* C_1 = -Psi'''/(2^5 3 pi^2) */
+    if (K >= 1)
+    {
+        arb_div_ui(C + 1, D + 3, 96, prec);
+        arb_div(C + 1, C + 1, pi2, prec);
+        arb_neg(C + 1, C + 1);
+    }
+
+    /* C_2 = Psi^(6)/(2^11 3^2 pi^4) + Psi''/(2^6 pi^2) */
+    if (K >= 2)
+    {
+        arb_div_ui(C + 2, D + 6, 18432, prec);
+        arb_div(C + 2, C + 2, pi2, prec);
+        arb_mul_2exp_si(x, D + 2, -6);
+        arb_add(C + 2, C + 2, x, prec);
+        arb_div(C + 2, C + 2, pi2, prec);
+    }
+
+    /* C_3 = -Psi^(9)/(2^16 3^4 pi^6) - Psi^(5)/(2^8 3 5 pi^4)
+             - Psi'/(2^6 pi^2) */
+    if (K >= 3)
+    {
+        arb_div_ui(C + 3, D + 9, 5308416, prec);
+        arb_div(C + 3, C + 3, pi2, prec);
+        arb_div_ui(x, D + 5, 3840, prec);
+        arb_add(C + 3, C + 3, x, prec);
+        arb_div(C + 3, C + 3, pi2, prec);
+        arb_mul_2exp_si(x, D + 1, -6);
+        arb_add(C + 3, C + 3, x, prec);
+        arb_div(C + 3, C + 3, pi2, prec);
+        arb_neg(C + 3, C + 3);
+    }
+
+    /* C_4 = Psi^(12)/(2^23 3^5 pi^8) + 11 Psi^(8)/(2^17 3^2 5 pi^6)
+             + 19 Psi^(4)/(2^13 3 pi^4) + Psi/(2^7 pi^2) */
+    if (K >= 4)
+    {
+        arb_div_ui(C + 4, D + 12, UWORD(2038431744), prec);
+        arb_div(C + 4, C + 4, pi2, prec);
+        arb_mul_ui(x, D + 8, 11, prec);
+        arb_div_ui(x, x, 5898240, prec);
+        arb_add(C + 4, C + 4, x, prec);
+        arb_div(C + 4, C + 4, pi2, prec);
+        arb_mul_ui(x, D + 4, 19, prec);
+        arb_div_ui(x, x, 24576, prec);
+        arb_add(C + 4, C + 4, x, prec);
+        arb_div(C + 4, C + 4, pi2, prec);
+        arb_mul_2exp_si(x, D, -7);
+        arb_add(C + 4, C + 4, x, prec);
+        arb_div(C + 4, C + 4, pi2, prec);
+    }
+
+    /* res = (-1)^(N-1) a^(-1/2) sum_{k <= K} C_k a^(-k) */
+    arb_inv(u, a, prec);
+    arb_set(res, C + K);
+    for (k = K - 1; k >= 0; k--)
+    {
+        arb_mul(res, res, u, prec);
+        arb_add(res, res, C + k, prec);
+    }
+
+    arb_rsqrt(u, a, prec);
+    arb_mul(res, res, u, prec);
+
+    if (N % 2 == 0)
+        arb_neg(res, res);
+
+    arb_add_error_mag(res, err);
+
+    arb_clear(a);
+    arb_clear(p);
+    arb_clear(u);
+    arb_clear(pi2);
+    arb_clear(x);
+    _arb_vec_clear(D, 13);
+    _arb_vec_clear(C, ARB_POLY_RS_MAX_K + 1);
+    mag_clear(err);
+    mag_clear(d);
+}
+
+void
+arb_poly_riemann_siegel_z_rs(arb_t res, const arb_t t, slong prec)
+{
+    arb_ptr tab;
+    arb_t theta, logn, x, s, c;
+    ulong N, n;
+    slong wp, L;
+
+    if (!_arb_poly_riemann_siegel_rs_N(&N, t))
+    {
+        arb_indeterminate(res);
+        return;
+    }
+
+    /* the arguments theta(t) - t log(n) have about log2(t) + log2(log(t))
+       integral bits, and the chain of logarithms adds up to N rounding
+       errors */
+    wp = prec + 3 * FLINT_BIT_COUNT(N) + 2 * FLINT_BIT_COUNT(FLINT_BIT_COUNT(N)) + 10;
+
+    arb_init(theta);
+    arb_init(logn);
+    arb_init(x);
+    arb_init(s);
+    arb_init(c);
+
+    _arb_poly_riemann_siegel_theta_series(theta, t, 1, 1, wp);
+
+    /* 2 sum_{n <= N} n^(-1/2) cos(theta(t) - t log(n)), getting each
+       log(n) from log(n-1) instead of storing N logarithms */
+    arb_zero(s);
+    arb_zero(logn);
+    for (n = 1; n <= N; n++)
+    {
+        arb_log_ui_from_prev(logn, n, logn, n - 1, wp);
+        arb_mul(x, t, logn, wp);
+        arb_sub(x, theta, x, wp);
+        arb_cos(x, x, wp);
+        arb_rsqrt_ui(c, n, wp);
+        arb_addmul(s, x, c, wp);
+    }
+    arb_mul_2exp_si(s, s, 1);
+
+    L = _arb_poly_riemann_siegel_rs_psi_len(prec + 10);
+    tab = _arb_vec_init(2 * L);
+    _arb_poly_riemann_siegel_rs_psi_tab(tab, L, prec + 10);
+    _arb_poly_riemann_siegel_rs_remainder(x, t, N, tab, L, wp);
+    _arb_vec_clear(tab, 2 * L);
+
+    arb_add(res, s, x, prec);
+
+    arb_clear(theta);
+    arb_clear(logn);
+    arb_clear(x);
+    arb_clear(s);
+    arb_clear(c);
+}
+
@@ -0,0 +1,247 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb_poly.h"
+#include "acb.h"
+
+/* the main sum F(t) = sum_{n <= N} n^(-1/2-it) is expanded in Taylor
+   series around the center of each block; blocks have width
+   at most BLOCK_WIDTH / log(N), so that |t - center| log(n) <= 4 */
+#define BLOCK_WIDTH 8.0
+
+/* number of Taylor terms T with 4 sqrt(N) x^T / T! < 2^-prec, T >= 2x */
+static slong
+taylor_terms(double x, ulong N, slong prec)
+{
+    double t;
+    slong T;
+
+    t = 2.0 + 0.5 * log(N) * 1.4426950408889634;
+
+    for (T = 1; ; T++)
+    {
+        t += log(x / T) * 1.4426950408889634;
+
+        if (T + 1 >= 2 * x && t < -prec)
+            return T;
+    }
+}
+
+void
+arb_poly_riemann_siegel_z_rs_vec(arb_ptr res, const arb_t t0, const arb_t h,
+    slong num, slong prec)
+{
+    arb_ptr tab;
+    acb_ptr M;
+    acb_t v, w, F, z;
+    arb_t t, tc, theta, logn, x, y;
+    mag_t xm, err, r;
+    ulong N, n;
+    slong i, j, j1, k, T, L, wp, tprec;
+    double step;
+
+    if (num <= 0)
+        return;
+
+    acb_init(v);
+    acb_init(w);
+    acb_init(F);
+    acb_init(z);
+    arb_init(t);
+    arb_init(tc);
+    arb_init(theta);
+    arb_init(logn);
+    arb_init(x);
+    arb_init(y);
+    mag_init(xm);
+    mag_init(err);
+    mag_init(r);
+
+    /* the points t0 + j h need to be computed to full precision */
+    arb_mul_si(t, h, num - 1, 2 * MAG_BITS);
+    arb_add(t, t, t0, 2 * MAG_BITS);
+    tprec = prec + 64 + FLINT_MAX(0, FLINT_MAX(
+        arf_abs_bound_lt_2exp_si(arb_midref(t0)),
+        arf_abs_bound_lt_2exp_si(arb_midref(t))));
+
+    L = _arb_poly_riemann_siegel_rs_psi_len(prec + 10);
+    tab = _arb_vec_init(2 * L);
+    _arb_poly_riemann_siegel_rs_psi_tab(tab, L, prec + 10);
+
+    step = fabs(arf_get_d(arb_midref(h), ARF_RND_NEAR));
+
+    for (j = 0; j < num; j = j1)
+    {
+        arb_mul_si(t, h, j, tprec);
+        arb_add(t, t, t0, tprec);
+
+        if (!_arb_poly_riemann_siegel_rs_N(&N, t))
+        {
+            arb_indeterminate(res + j);
+            j1 = j + 1;
+            continue;
+        }
+
+        wp = prec + 3 * FLINT_BIT_COUNT(N)
+            + 2 * FLINT_BIT_COUNT(FLINT_BIT_COUNT(N)) + 10;
+
+        /* block of points with the same N */
+        if (step * log(N) > BLOCK_WIDTH)
+            j1 = j + 1;
+        else if (step == 0.0)
+            j1 = num;
+        else
+            j1 = j + 1 + (slong) FLINT_MIN((double) num,
+                BLOCK_WIDTH / (step * log(N)));
+
+        j1 = FLINT_MIN(j1, num);
+
+        for (i = j + 1; i < j1; i++)
+        {
+            ulong N2;
+
+            arb_mul_si(x, h, i, tprec);
+            arb_add(x, x, t0, tprec);
+
+            if (!_arb_poly_riemann_siegel_rs_N(&N2, x) || N2 != N)
+            {
+                j1 = i;
+                break;
+            }
+        }
+
+        /* exact center tc of the block, and xm >= |t - tc| log(N) */
+        arb_mul_si(tc, h, j1 - 1, tprec);
+        arb_add(tc, tc, t0, tprec);
+        arb_add(tc, tc, t, tprec);
+        arb_mul_2exp_si(tc, tc, -1);
+        arb_get_mid_arb(tc, tc);
+
+        arb_sub(x, tc, t, tprec);
+        arb_get_mag(xm, x);
+        arb_mul_si(x, h, j1 - 1, tprec);
+        arb_add(x, x, t0, tprec);
+        arb_sub(x, x, tc, tprec);
+        arb_get_mag(r, x);
+        if (mag_cmp(r, xm) > 0)
+            mag_swap(r, xm);
+        arb_log_ui(logn, N, MAG_BITS);
+        arb_get_mag(r, logn);
+        mag_mul(xm, xm, r);
+
+        T = taylor_terms(mag_get_d(xm), N, wp);
+
+        /* the moments cost about T evaluations of the main sum, so
+           short blocks are cheaper to evaluate point by point */
+        if (j1 - j <= T)
+        {
+            for (i = j; i < j1; i++)
+            {
+                arb_mul_si(t, h, i, tprec);
+                arb_add(t, t, t0, tprec);
+                arb_poly_riemann_siegel_z_rs(res + i, t, prec);
+            }
+            continue;
+        }
+
+        /* err = 4 sqrt(N) xm^T / T! bounds the truncation error */
+        mag_pow_ui(err, xm, T);
+        mag_rfac_ui(r, T);
+        mag_mul(err, err, r);
+        mag_set_ui(r, N);
+        mag_sqrt(r, r);
+        mag_mul(err, err, r);
+        mag_mul_2exp_si(err, err, 2);
+
+        /* M_k = sum_{n <= N} n^(-1/2-i tc) log(n)^k */
+        M = _acb_vec_init(T);
+
+        arb_zero(logn);
+        for (n = 1; n <= N; n++)
+        {
+            arb_log_ui_from_prev(logn, n, logn, n - 1, wp);
+            arb_mul(x, tc, logn, wp);
+            arb_sin_cos(acb_imagref(v), acb_realref(v), x, wp);
+            arb_neg(acb_imagref(v), acb_imagref(v));
+            arb_rsqrt_ui(x, n, wp);
+            acb_mul_arb(v, v, x, wp);
+
+            for (k = 0; k < T; k++)
+            {
+                acb_add(M + k, M + k, v, wp);
+                if (k < T - 1)
+                    acb_mul_arb(v, v, logn, wp);
+            }
+        }
+
+        for (i = j; i < j1; i++)
+        {
+            arb_mul_si(t, h, i, tprec);
+            arb_add(t, t, t0, tprec);
+
+            /* F = sum_k M_k z^k / k!, z = -i (t - tc) */
+            arb_sub(acb_imagref(z), tc, t, wp);
+            arb_zero(acb_realref(z));
+
+            acb_set(F, M + T - 1);
+            for (k = T - 1; k >= 1; k--)
+            {
+                acb_mul(F, F, z, wp);
+                acb_div_ui(F, F, k, wp);
+                acb_add(F, F, M + k - 1, wp);
+            }
+
+            acb_add_error_mag(F, err);
+
+            /* Z = 2 Re(exp(i theta) F) + remainder */
+            _arb_poly_riemann_siegel_theta_series(theta, t, 1, 1, wp);
+            arb_sin_cos(acb_imagref(w), acb_realref(w), theta, wp);
+            acb_mul(w, w, F, wp);
+            arb_mul_2exp_si(y, acb_realref(w), 1);
+
+            _arb_poly_riemann_siegel_rs_remainder(x, t, N, tab, L, wp);
+            arb_add(res + i, y, x, prec);
+        }
+
+        _acb_vec_clear(M, T);
+    }
+
+    _arb_vec_clear(tab, 2 * L);
+
+    acb_clear(v);
+    acb_clear(w);
+    acb_clear(F);
+    acb_clear(z);
+    arb_clear(t);
+    arb_clear(tc);
+    arb_clear(theta);
+    arb_clear(logn);
+    arb_clear(x);
+    arb_clear(y);
+    mag_clear(xm);
+    mag_clear(err);
+    mag_clear(r);
+}
+
@@ -0,0 +1,95 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+
+#include "arb_poly.h"
+
+void
+_arb_poly_taylor_shift_convolution(arb_ptr poly, const arb_t c, slong n, slong prec)
+{
+    arb_ptr t, u;
+    arb_t f;
+    slong i, d;
+
+    if (n <= 1 || arb_is_zero(c))
+        return;
+
+    d = n - 1;
+
+    t = _arb_vec_init(n);
+    u = _arb_vec_init(n);
+    arb_init(f);
+
+    /* u_i = i! a_i, reversed */
+    arb_one(f);
+    for (i = 0; i <= d; i++)
+    {
+        if (i > 1)
+            arb_mul_ui(f, f, i, prec);
+        arb_mul(u + d - i, poly + i, f, prec);
+    }
+
+    /* t_j = d! / j! c^j; all these are integers times powers of c */
+    arb_one(t + d);
+    for (i = d; i > 0; i--)
+        arb_mul_ui(t + i - 1, t + i, i, prec);
+
+    if (!arb_is_one(c))
+    {
+        arb_set(f, c);
+        for (i = 1; i <= d; i++)
+        {
+            arb_mul(t + i, t + i, f, prec);
+            if (i < d)
+                arb_mul(f, f, c, prec);
+        }
+    }
+
+    /* u_{d-k} = d! k! b_k */
+    _arb_poly_mullow(poly, u, n, t, n, n, prec);
+    _arb_poly_reverse(u, poly, n, n);
+
+    arb_set(f, t + 0);
+    for (i = 0; i <= d; i++)
+    {
+        if (i > 1)
+            arb_mul_ui(f, f, i, prec);
+        arb_div(poly + i, u + i, f, prec);
+    }
+
+    _arb_vec_clear(t, n);
+    _arb_vec_clear(u, n);
+    arb_clear(f);
+}
+
+void
+arb_poly_taylor_shift_convolution(arb_poly_t g, const arb_poly_t f,
+    const arb_t c, slong prec)
+{
+    if (f != g)
+        arb_poly_set(g, f);
+
+    _arb_poly_taylor_shift_convolution(g->coeffs, c, g->length, prec);
+}
@@ -0,0 +1,90 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+
+#include "arb_poly.h"
+
+#define CUTOFF 16
+
+void
+_arb_poly_taylor_shift_divconquer(arb_ptr poly, const arb_t c, slong n, slong prec)
+{
+    arb_ptr t, u;
+    fmpz_t b;
+    slong k, n1, n2;
+
+    if (n < CUTOFF || arb_is_zero(c))
+    {
+        _arb_poly_taylor_shift_horner(poly, c, n, prec);
+        return;
+    }
+
+    /* f(x) = A(x) + x^n1 B(x), f(x+c) = A(x+c) + (x+c)^n1 B(x+c) */
+    n1 = n / 2;
+    n2 = n - n1;
+
+    _arb_poly_taylor_shift_divconquer(poly, c, n1, prec);
+    _arb_poly_taylor_shift_divconquer(poly + n1, c, n2, prec);
+
+    t = _arb_vec_init(n1 + 1);
+    u = _arb_vec_init(n);
+    fmpz_init(b);
+
+    /* t = (x+c)^n1 */
+    _arb_vec_set_powers(u, c, n1 + 1, prec);
+    fmpz_one(b);
+    for (k = 0; k <= n1; k++)
+    {
+        if (k != 0)
+        {
+            fmpz_mul_ui(b, b, n1 - k + 1);
+            fmpz_divexact_ui(b, b, k);
+        }
+
+        arb_mul_fmpz(t + k, u + n1 - k, b, prec);
+    }
+
+    if (n2 >= n1 + 1)
+        _arb_poly_mul(u, poly + n1, n2, t, n1 + 1, prec);
+    else
+        _arb_poly_mul(u, t, n1 + 1, poly + n1, n2, prec);
+
+    _arb_vec_add(poly, poly, u, n1, prec);
+    _arb_vec_set(poly + n1, u + n1, n2);
+
+    _arb_vec_clear(t, n1 + 1);
+    _arb_vec_clear(u, n);
+    fmpz_clear(b);
+}
+
+void
+arb_poly_taylor_shift_divconquer(arb_poly_t g, const arb_poly_t f,
+    const arb_t c, slong prec)
+{
+    if (f != g)
+        arb_poly_set(g, f);
+
+    _arb_poly_taylor_shift_divconquer(g->coeffs, c, g->length, prec);
+}
@@ -47,6 +47,12 @@ int main()
         rbits2 = 2 + n_randint(state, 200);
         n = 2 + n_randint(state, 25);
 
+        if (iter % 50 == 0)
+        {
+            flint_set_num_threads(1 + n_randint(state, 4));
+            n = 2 + n_randint(state, 150);
+        }
+
         fmpq_poly_init(A);
         fmpq_poly_init(B);
 
@@ -94,6 +100,7 @@ int main()
         arb_poly_clear(c);
     }
 
+    flint_set_num_threads(1);
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
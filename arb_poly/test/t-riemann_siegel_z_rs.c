@@ -0,0 +1,88 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb_poly.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("riemann_siegel_z_rs....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 500; iter++)
+    {
+        arb_t t, z1, z2;
+        slong prec1, prec2;
+
+        arb_init(t);
+        arb_init(z1);
+        arb_init(z2);
+
+        prec1 = 2 + n_randint(state, 80);
+        prec2 = 2 + n_randint(state, 80);
+
+        arb_set_ui(t, 200 + n_randint(state, 4000));
+        arb_randtest(z1, state, 1 + n_randint(state, 100), 0);
+        arb_abs(z1, z1);
+        arb_add(t, t, z1, 200);
+
+        arb_poly_riemann_siegel_z_rs(z1, t, prec1);
+
+        {
+            arb_poly_t a, b;
+
+            arb_poly_init(a);
+            arb_poly_init(b);
+            arb_poly_set_coeff_arb(a, 0, t);
+            arb_poly_riemann_siegel_z_series(b, a, 1, prec2);
+            arb_poly_get_coeff_arb(z2, b, 0);
+            arb_poly_clear(a);
+            arb_poly_clear(b);
+        }
+
+        if (!arb_overlaps(z1, z2))
+        {
+            flint_printf("FAIL: overlap\n\n");
+            flint_printf("t = "); arb_printd(t, 30); flint_printf("\n\n");
+            flint_printf("z1 = "); arb_printd(z1, 30); flint_printf("\n\n");
+            flint_printf("z2 = "); arb_printd(z2, 30); flint_printf("\n\n");
+            abort();
+        }
+
+        arb_clear(t);
+        arb_clear(z1);
+        arb_clear(z2);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
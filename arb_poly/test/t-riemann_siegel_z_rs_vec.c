@@ -0,0 +1,90 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb_poly.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("riemann_siegel_z_rs_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 200; iter++)
+    {
+        arb_t t0, h, t, z;
+        arb_ptr v;
+        slong j, num, prec1, prec2;
+
+        arb_init(t0);
+        arb_init(h);
+        arb_init(t);
+        arb_init(z);
+
+        num = n_randint(state, 100);
+        prec1 = 2 + n_randint(state, 80);
+        prec2 = 2 + n_randint(state, 80);
+
+        arb_set_ui(t0, 200 + n_randint(state, 20000));
+        arb_set_ui(h, 1 + n_randint(state, 100));
+        arb_mul_2exp_si(h, h, -(slong) n_randint(state, 10));
+
+        v = _arb_vec_init(num);
+
+        arb_poly_riemann_siegel_z_rs_vec(v, t0, h, num, prec1);
+
+        for (j = 0; j < num; j++)
+        {
+            arb_mul_si(t, h, j, 200);
+            arb_add(t, t, t0, 200);
+            arb_poly_riemann_siegel_z_rs(z, t, prec2);
+
+            if (!arb_overlaps(v + j, z))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("j = %wd\n\n", j);
+                flint_printf("t = "); arb_printd(t, 30); flint_printf("\n\n");
+                flint_printf("v = "); arb_printd(v + j, 30); flint_printf("\n\n");
+                flint_printf("z = "); arb_printd(z, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _arb_vec_clear(v, num);
+        arb_clear(t0);
+        arb_clear(h);
+        arb_clear(t);
+        arb_clear(z);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,159 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+
+#include "arb_poly.h"
+
+static void
+taylor_shift(arb_poly_t g, const arb_poly_t f, const arb_t c, slong prec,
+    int algorithm)
+{
+    switch (algorithm)
+    {
+        case 0:
+            arb_poly_taylor_shift_horner(g, f, c, prec);
+            break;
+        case 1:
+            arb_poly_taylor_shift_divconquer(g, f, c, prec);
+            break;
+        case 2:
+            arb_poly_taylor_shift_convolution(g, f, c, prec);
+            break;
+        default:
+            arb_poly_taylor_shift(g, f, c, prec);
+    }
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("taylor_shift....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000; iter++)
+    {
+        slong qbits1, qbits2, rbits1, rbits2, rbits3;
+        fmpq_poly_t A, B, C;
+        fmpq_t c;
+        arb_poly_t a, b[4];
+        arb_t d;
+        int i, j;
+
+        qbits1 = 2 + n_randint(state, 200);
+        qbits2 = 2 + n_randint(state, 200);
+        rbits1 = 2 + n_randint(state, 200);
+        rbits2 = 2 + n_randint(state, 200);
+        rbits3 = 2 + n_randint(state, 200);
+
+        fmpq_poly_init(A);
+        fmpq_poly_init(B);
+        fmpq_poly_init(C);
+        fmpq_init(c);
+
+        arb_poly_init(a);
+        for (i = 0; i < 4; i++)
+            arb_poly_init(b[i]);
+        arb_init(d);
+
+        fmpq_poly_randtest(A, state, 1 + n_randint(state, 100), qbits1);
+
+        switch (n_randint(state, 4))
+        {
+            case 0:
+                fmpq_one(c);
+                break;
+            case 1:
+                fmpq_set_si(c, -1, 1);
+                break;
+            default:
+                fmpq_randtest(c, state, qbits2);
+        }
+
+        fmpq_poly_set_coeff_si(B, 1, 1);
+        fmpq_poly_set_coeff_fmpq(B, 0, c);
+        fmpq_poly_compose(C, A, B);
+
+        arb_poly_set_fmpq_poly(a, A, rbits1);
+        arb_set_fmpq(d, c, rbits2);
+
+        /* horner, divconquer, convolution and the default must all
+           contain the exact shift, and hence overlap each other */
+        for (i = 0; i < 4; i++)
+        {
+            taylor_shift(b[i], a, d, rbits3, i);
+
+            if (!arb_poly_contains_fmpq_poly(b[i], C))
+            {
+                flint_printf("FAIL (algorithm %d)\n\n", i);
+                flint_printf("A = "); fmpq_poly_print(A); flint_printf("\n\n");
+                flint_printf("c = "); fmpq_print(c); flint_printf("\n\n");
+                flint_printf("C = "); fmpq_poly_print(C); flint_printf("\n\n");
+                flint_printf("b = "); arb_poly_printd(b[i], 15); flint_printf("\n\n");
+                abort();
+            }
+
+            for (j = 0; j < i; j++)
+            {
+                if (!arb_poly_overlaps(b[i], b[j]))
+                {
+                    flint_printf("FAIL (overlap, algorithms %d, %d)\n\n", j, i);
+                    flint_printf("A = "); fmpq_poly_print(A); flint_printf("\n\n");
+                    flint_printf("c = "); fmpq_print(c); flint_printf("\n\n");
+                    flint_printf("b1 = "); arb_poly_printd(b[j], 15); flint_printf("\n\n");
+                    flint_printf("b2 = "); arb_poly_printd(b[i], 15); flint_printf("\n\n");
+                    abort();
+                }
+            }
+        }
+
+        i = n_randint(state, 4);
+        taylor_shift(a, a, d, rbits3, i);
+
+        if (!arb_poly_equal(a, b[i]))
+        {
+            flint_printf("FAIL (aliasing, algorithm %d)\n\n", i);
+            abort();
+        }
+
+        fmpq_poly_clear(A);
+        fmpq_poly_clear(B);
+        fmpq_poly_clear(C);
+        fmpq_clear(c);
+
+        arb_poly_clear(a);
+        for (i = 0; i < 4; i++)
+            arb_poly_clear(b[i]);
+        arb_clear(d);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
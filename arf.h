@@ -1312,6 +1312,7 @@ int arf_complex_sqr(arf_t e, arf_t f, const arf_t a, const arf_t b,
 int arf_sum(arf_t s, arf_srcptr terms, slong len, slong prec, arf_rnd_t rnd);
 
 double arf_get_d(const arf_t x, arf_rnd_t rnd);
+int _arf_get_d_fast(double * v, const arf_t x);
 void arf_set_d(arf_t x, double v);
 
 #ifdef __cplusplus
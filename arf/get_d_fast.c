@@ -0,0 +1,65 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arf.h"
+
+int
+_arf_get_d_fast(double * v, const arf_t x)
+{
+    slong exp;
+
+    if (arf_is_special(x) || COEFF_IS_MPZ(ARF_EXP(x)))
+        return 0;
+
+    exp = ARF_EXP(x);
+
+    if (exp < -500 || exp > 500)
+        return 0;
+
+#if FLINT_BITS == 64
+    {
+        mp_srcptr xp;
+        mp_size_t xn;
+
+        ARF_GET_MPN_READONLY(xp, xn, x);
+
+        if (xn != 1 || (xp[0] & UWORD(0x7ff)) != 0)
+            return 0;
+
+        *v = ldexp((double) (xp[0] >> 11), exp - 53);
+
+        if (ARF_SGNBIT(x))
+            *v = -(*v);
+    }
+#else
+    if (arf_bits(x) > 53)
+        return 0;
+
+    *v = arf_get_d(x, ARF_RND_DOWN);
+#endif
+
+    return 1;
+}
+
@@ -0,0 +1,84 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arf.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("get_d_fast....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100000; iter++)
+    {
+        arf_t x, z;
+        double v;
+        int success, expected;
+
+        arf_init(x);
+        arf_init(z);
+
+        arf_randtest_special(x, state, 1 + n_randint(state, 100), 1 + n_randint(state, 12));
+
+        expected = arf_is_finite(x) && !arf_is_zero(x) && arf_bits(x) <= 53
+            && arf_cmpabs_2exp_si(x, -501) >= 0 && arf_cmpabs_2exp_si(x, 500) < 0;
+
+        success = _arf_get_d_fast(&v, x);
+
+        if (success != expected)
+        {
+            flint_printf("FAIL (success)\n\n");
+            flint_printf("x = "); arf_print(x); flint_printf("\n\n");
+            flint_printf("success = %d, expected = %d\n\n", success, expected);
+            abort();
+        }
+
+        if (success)
+        {
+            arf_set_d(z, v);
+
+            if (!arf_equal(x, z))
+            {
+                flint_printf("FAIL (value)\n\n");
+                flint_printf("x = "); arf_print(x); flint_printf("\n\n");
+                flint_printf("z = "); arf_print(z); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        arf_clear(x);
+        arf_clear(z);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -23,8 +23,12 @@
 
 ******************************************************************************/
 
+#include <pthread.h>
 #include "hypgeom.h"
 
+/* fork subtrees onto threads when (b - a) * prec exceeds this */
+#define THREADED_CUTOFF 250000
+
 static __inline__ void
 fmpz_poly_evaluate_si(fmpz_t y, const fmpz_poly_t poly, slong x)
 {
@@ -226,9 +230,65 @@ fmprb_hypgeom_infsum(fmprb_t P, fmprb_t Q, hypgeom_t hyp, slong target_prec, slo
     mag_clear(err);
 }
 
+typedef struct
+{
+    arb_ptr P;
+    arb_ptr Q;
+    arb_ptr B;
+    arb_ptr T;
+    const hypgeom_struct * hyp;
+    slong a;
+    slong b;
+    int cont;
+    slong prec;
+    slong num_threads;
+}
+bsplit_arg_t;
+
+typedef struct
+{
+    arb_ptr Q;
+    arb_srcptr Q2;
+    arb_ptr P2;
+    arb_srcptr P;
+    int cont;
+    slong prec;
+}
+mul_arg_t;
+
+static void bsplit_recursive_arb(arb_t P, arb_t Q, arb_t B, arb_t T,
+    const hypgeom_t hyp, slong a, slong b, int cont, slong prec,
+    slong num_threads);
+
+static void *
+bsplit_worker(void * arg_ptr)
+{
+    bsplit_arg_t arg = *((bsplit_arg_t *) arg_ptr);
+
+    bsplit_recursive_arb(arg.P, arg.Q, arg.B, arg.T, arg.hyp,
+        arg.a, arg.b, arg.cont, arg.prec, arg.num_threads);
+
+    flint_cleanup();
+    return NULL;
+}
+
+static void *
+mul_worker(void * arg_ptr)
+{
+    mul_arg_t arg = *((mul_arg_t *) arg_ptr);
+
+    arb_mul(arg.Q, arg.Q, arg.Q2, arg.prec);
+    if (arg.cont)
+        arb_mul(arg.P2, arg.P, arg.P2, arg.prec);
+
+    flint_cleanup();
+    return NULL;
+}
+
 static void
 bsplit_recursive_arb(arb_t P, arb_t Q, arb_t B, arb_t T,
-    const hypgeom_t hyp, slong a, slong b, int cont, slong prec)
+    const hypgeom_t hyp, slong a, slong b, int cont, slong prec,
+    slong num_threads)
 {
     if (b - a < 4)
     {
@@ -255,6 +315,8 @@ bsplit_recursive_arb(arb_t P, arb_t Q, arb_t B, arb_t T,
     {
         slong m;
         arb_t P2, Q2, B2, T2;
+        pthread_t thread;
+        int threaded;
 
         m = (a + b) / 2;
 
@@ -263,8 +325,49 @@ bsplit_recursive_arb(arb_t P, arb_t Q, arb_t B, arb_t T,
         arb_init(B2);
         arb_init(T2);
 
-        bsplit_recursive_arb(P, Q, B, T, hyp, a, m, 1, prec);
-        bsplit_recursive_arb(P2, Q2, B2, T2, hyp, m, b, 1, prec);
+        threaded = num_threads > 1 && (b - a) * (double) prec > THREADED_CUTOFF;
+
+        if (threaded)
+        {
+            bsplit_arg_t arg;
+
+            arg.P = P2;
+            arg.Q = Q2;
+            arg.B = B2;
+            arg.T = T2;
+            arg.hyp = hyp;
+            arg.a = m;
+            arg.b = b;
+            arg.cont = 1;
+            arg.prec = prec;
+            arg.num_threads = num_threads / 2;
+
+            pthread_create(&thread, NULL, bsplit_worker, &arg);
+            bsplit_recursive_arb(P, Q, B, T, hyp, a, m, 1, prec,
+                num_threads - num_threads / 2);
+            pthread_join(thread, NULL);
+        }
+        else
+        {
+            bsplit_recursive_arb(P, Q, B, T, hyp, a, m, 1, prec, 1);
+            bsplit_recursive_arb(P2, Q2, B2, T2, hyp, m, b, 1, prec, 1);
+        }
+
+        /* Q * Q2 and P * P2 are computed in parallel with the update
+           of T; the result is the same as in the serial version */
+        if (threaded)
+        {
+            mul_arg_t arg;
+
+            arg.Q = Q;
+            arg.Q2 = Q2;
+            arg.P2 = P2;
+            arg.P = P;
+            arg.cont = cont;
+            arg.prec = prec;
+
+            pthread_create(&thread, NULL, mul_worker, &arg);
+        }
 
         if (arb_is_one(B) && arb_is_one(B2))
         {
@@ -280,9 +383,19 @@ bsplit_recursive_arb(arb_t P, arb_t Q, arb_t B, arb_t T,
         }
 
         arb_mul(B, B, B2, prec);
-        arb_mul(Q, Q, Q2, prec);
-        if (cont)
-            arb_mul(P, P, P2, prec);
+
+        if (threaded)
+        {
+            pthread_join(thread, NULL);
+            if (cont)
+                arb_swap(P, P2);
+        }
+        else
+        {
+            arb_mul(Q, Q, Q2, prec);
+            if (cont)
+                arb_mul(P, P, P2, prec);
+        }
 
         arb_clear(P2);
         arb_clear(Q2);
@@ -304,7 +417,8 @@ arb_hypgeom_sum(arb_t P, arb_t Q, const hypgeom_t hyp, slong n, slong prec)
         arb_t B, T;
         arb_init(B);
         arb_init(T);
-        bsplit_recursive_arb(P, Q, B, T, hyp, 0, n, 0, prec);
+        bsplit_recursive_arb(P, Q, B, T, hyp, 0, n, 0, prec,
+            flint_get_num_threads());
         if (!arb_is_one(B))
             arb_mul(Q, Q, B, prec);
         arb_swap(P, T);
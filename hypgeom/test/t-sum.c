@@ -0,0 +1,119 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2015 Fredrik Johansson
+
+******************************************************************************/
+#include "hypgeom.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("sum....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 200; iter++)
+    {
+        hypgeom_t hyp;
+        arb_t P1, Q1, P2, Q2, t;
+        fmprb_t P3, Q3;
+        slong n, prec;
+
+        hypgeom_init(hyp);
+        arb_init(P1);
+        arb_init(Q1);
+        arb_init(P2);
+        arb_init(Q2);
+        arb_init(t);
+        fmprb_init(P3);
+        fmprb_init(Q3);
+
+        do {
+            fmpz_poly_randtest(hyp->A, state, 1 + n_randint(state, 3), 10);
+            fmpz_poly_randtest(hyp->B, state, 1 + n_randint(state, 3), 10);
+            fmpz_poly_randtest(hyp->P, state, 1 + n_randint(state, 3), 10);
+            fmpz_poly_randtest(hyp->Q, state, 1 + n_randint(state, 3), 10);
+        } while (fmpz_poly_is_zero(hyp->A) || fmpz_poly_is_zero(hyp->B)
+            || fmpz_poly_is_zero(hyp->P) || fmpz_poly_is_zero(hyp->Q));
+
+        n = n_randint(state, 3000);
+        prec = 2 + n_randint(state, 1000);
+
+        flint_set_num_threads(1);
+        arb_hypgeom_sum(P1, Q1, hyp, n, prec);
+
+        flint_set_num_threads(2 + n_randint(state, 4));
+        arb_hypgeom_sum(P2, Q2, hyp, n, prec);
+
+        /* the threaded version performs the same operations */
+        if (!arb_equal(P1, P2) || !arb_equal(Q1, Q2))
+        {
+            flint_printf("FAIL: threaded\n\n");
+            flint_printf("n = %wd, prec = %wd\n\n", n, prec);
+            flint_printf("P1 = "); arb_printd(P1, 30); flint_printf("\n\n");
+            flint_printf("P2 = "); arb_printd(P2, 30); flint_printf("\n\n");
+            flint_printf("Q1 = "); arb_printd(Q1, 30); flint_printf("\n\n");
+            flint_printf("Q2 = "); arb_printd(Q2, 30); flint_printf("\n\n");
+            abort();
+        }
+
+        fmprb_hypgeom_sum(P3, Q3, hyp, n, prec);
+
+        arb_set_fmprb(t, P3);
+        if (!arb_overlaps(P1, t))
+        {
+            flint_printf("FAIL: overlap (P)\n\n");
+            flint_printf("n = %wd, prec = %wd\n\n", n, prec);
+            flint_printf("P1 = "); arb_printd(P1, 30); flint_printf("\n\n");
+            flint_printf("P3 = "); arb_printd(t, 30); flint_printf("\n\n");
+            abort();
+        }
+
+        arb_set_fmprb(t, Q3);
+        if (!arb_overlaps(Q1, t))
+        {
+            flint_printf("FAIL: overlap (Q)\n\n");
+            flint_printf("n = %wd, prec = %wd\n\n", n, prec);
+            flint_printf("Q1 = "); arb_printd(Q1, 30); flint_printf("\n\n");
+            flint_printf("Q3 = "); arb_printd(t, 30); flint_printf("\n\n");
+            abort();
+        }
+
+        hypgeom_clear(hyp);
+        arb_clear(P1);
+        arb_clear(Q1);
+        arb_clear(P2);
+        arb_clear(Q2);
+        arb_clear(t);
+        fmprb_clear(P3);
+        fmprb_clear(Q3);
+    }
+
+    flint_set_num_threads(1);
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}